@@ -5,3 +5,9 @@ dune_define_gridtype(GRID_CONFIG_H_BOTTOM GRIDTYPE MOVINGMESH
 dune_define_gridtype(GRID_CONFIG_H_BOTTOM GRIDTYPE MMESH
     DUNETYPE "Dune::MovingMesh< dimgrid >"
     HEADERS dune/mmesh/mmesh.hh)
+
+# use OpenMP for the shared memory parallel loops if available
+find_package(OpenMP)
+if(OpenMP_CXX_FOUND)
+  dune_register_package_flags(LIBRARIES OpenMP::OpenMP_CXX)
+endif()
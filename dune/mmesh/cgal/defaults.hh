@@ -3,6 +3,9 @@
 #ifndef DUNE_MMESH_CGAL_DEFAULTS_HH
 #define DUNE_MMESH_CGAL_DEFAULTS_HH
 
+#include <array>
+#include <cstdint>
+
 // MMesh includes
 #include "../grid/declaration.hh"
 
@@ -20,31 +23,45 @@ namespace MMeshDefaults {
 
 /*!
  * \brief The element and vertex infos used by the dune-mmesh implementation
+ *
+ * The infos are stored in every host cell and vertex, hence, we use the
+ * narrowest integer types that fit and order the members by size. Indices
+ * are limited to 32 bits. The connectivity of border elements in parallel
+ * runs is stored in the PartitionHelper.
  */
 
 template <int dim>
 struct ElementInfo {
-  std::size_t insertionIndex;
-  std::size_t index;
-  std::array<std::size_t, dim + 1> cgalIndex;
-  size_t domainMarker = 0;
-  int mark = 0;
+  using Index = std::uint32_t;
+  using LocalIndex = std::uint8_t;
+
+  Index insertionIndex;
+  Index index;
+  std::array<Index, dim + 1> facetIndex;  // by CGAL facet index
+  std::array<Index, (dim == 3) ? 6 : 0> edgeIndex;  // by cgalEdgeIndex
+  Index componentNumber = 0;
+  std::uint32_t domainMarker = 0;
+  std::int32_t rank = 0;
+  std::array<LocalIndex, dim + 1> cgalIndex;
+  std::array<LocalIndex, dim + 1> duneIndex;  // inverse of cgalIndex
+  std::uint8_t interfaceFacets = 0;  // bit i: facet i is interface
+  std::uint8_t interfaceEdges = 0;   // bit cgalEdgeIndex: edge is interface
+  std::int8_t mark = 0;
+  std::int8_t partition = 0;
   bool isNew = false;
   bool mightVanish = false;
-  std::size_t componentNumber = 0;
-  int rank = 0;
-  int partition = 0;
-  std::unordered_set<int> connectivity;
 };
 
 struct VertexInfo {
+  using Index = std::uint32_t;
+
   std::size_t id;
+  Index index;
+  std::uint16_t insertionLevel = 0;
+  std::int8_t boundaryFlag = -1;
+  std::int8_t partition = 0;
   bool idWasSet = false;
-  std::size_t index;
-  std::size_t insertionLevel = 0;
   bool isInterface = false;
-  int boundaryFlag = -1;
-  int partition = 0;
 };
 
 /*!
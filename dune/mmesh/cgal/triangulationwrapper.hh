@@ -6,6 +6,11 @@
 /** \file
  * \brief A CGAL triangulation wrapper class
  */
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
 #include <dune/grid/common/exceptions.hh>
 #include <dune/mmesh/grid/pointfieldvector.hh>
 
@@ -62,6 +67,19 @@ class TriangulationWrapper<2> : public MMeshDefaults::Triangulation<2>::type {
     this->delete_vertex(vh);
   }
 
+  /** \brief Flip the edge opposite to vertex i of the face f
+   *
+   *  The two faces are reused by the flip and returned as new elements.
+   *  The caller has to ensure that the quadrilateral is convex.
+   */
+  template <class Elements>
+  void flipAndGiveNewElements(const CellHandle& f, int i, Elements& elements) {
+    const CellHandle n = f->neighbor(i);
+    this->tds().flip(f, i);
+    elements.push_back(f);
+    elements.push_back(n);
+  }
+
   template <class VertexHandle, class Elements>
   void remeshHoleConstrained(const VertexHandle& vh,
                              std::list<FacetHandle>& hole, Elements& elements,
@@ -151,9 +169,270 @@ class TriangulationWrapper<3> : public MMeshDefaults::Triangulation<3>::type {
   using BaseType = typename MMeshDefaults::Triangulation<3>::type;
 
  public:
-  template <class VertexHandle, class Elements>
-  void removeAndGiveNewElements(const VertexHandle& v, Elements fit) {
-    DUNE_THROW(GridError, "Removal is not supported in 3D!");
+  /** \brief Remove the vertex v and re-tetrahedralize its star
+   *
+   *  The vertex is collapsed onto the adjacent vertex returned by
+   *  collapseTarget(). Returns the new cells, or nothing if v can not be
+   *  removed, e.g. at the boundary.
+   */
+  template <class Elements>
+  void removeAndGiveNewElements(const Vertex_handle& v, Elements& elements) {
+    std::vector<Vertex_handle> targets;
+    this->finite_adjacent_vertices(v, std::back_inserter(targets));
+
+    const Vertex_handle w = collapseTarget(v, targets);
+    if (w != Vertex_handle()) collapseAndGiveNewElements(v, w, elements);
+  }
+
+  /** \brief Return the target of the collapse of v that maximizes the
+   *         minimal mean ratio of the new cells
+   *
+   *  The hole of the star of v is filled by the cone from the target. A
+   *  target is valid if the edge collapse satisfies the link condition and
+   *  all new cells are positively oriented. Returns a null handle if no
+   *  target is valid or v is at the boundary.
+   */
+  Vertex_handle collapseTarget(
+      const Vertex_handle& v, const std::vector<Vertex_handle>& targets) const {
+    std::vector<Cell_handle> star;
+    this->incident_cells(v, std::back_inserter(star));
+    for (const auto& c : star)
+      if (this->is_infinite(c)) return Vertex_handle();
+
+    Vertex_handle best;
+    double bestQuality = 0.0;
+    for (const auto& w : targets) {
+      const double quality = collapseQuality_(v, w, star);
+      if (quality > bestQuality) {
+        best = w;
+        bestQuality = quality;
+      }
+    }
+    return best;
+  }
+
+  /** \brief Collapse the vertex v onto the adjacent vertex w
+   *
+   *  The cells incident to the edge (v, w) vanish, the other cells of the
+   *  star of v are replaced by cells with v replaced by w. Returns the new
+   *  cells. The caller has to ensure that w is a valid collapseTarget().
+   */
+  template <class Elements>
+  void collapseAndGiveNewElements(const Vertex_handle& v,
+                                  const Vertex_handle& w, Elements& elements) {
+    std::vector<Cell_handle> star;
+    this->incident_cells(v, std::back_inserter(star));
+
+    std::map<Cell_handle, Cell_handle> kept;
+    for (const auto& c : star)
+      if (!c->has_vertex(w)) {
+        const Cell_handle n = this->tds().create_cell(
+            c->vertex(0), c->vertex(1), c->vertex(2), c->vertex(3));
+        n->set_vertex(c->index(v), w);
+        n->info().domainMarker = c->info().domainMarker;
+        kept.insert({c, n});
+        elements.push_back(n);
+      }
+
+    for (const auto& [c, n] : kept)
+      for (int k = 0; k < 4; ++k) {
+        Cell_handle old = c;
+        Cell_handle neighbor = c->neighbor(k);
+
+        if (k != c->index(v)) {
+          auto it = kept.find(neighbor);
+          if (it != kept.end()) {
+            n->set_neighbor(k, it->second);
+            continue;
+          }
+
+          // the neighbor is incident to (v, w), glue to the cell behind it
+          old = neighbor;
+          neighbor = old->neighbor(old->index(v));
+        }
+
+        n->set_neighbor(k, neighbor);
+        neighbor->set_neighbor(neighbor->index(old), n);
+      }
+
+    for (const auto& [c, n] : kept)
+      for (int k = 0; k < 4; ++k) n->vertex(k)->set_cell(n);
+
+    for (const auto& c : star) this->tds().delete_cell(c);
+    this->tds().delete_vertex(v);
+  }
+
+  /** \brief 2-3 flip of the facet opposite to vertex i of the cell c
+   *
+   *  Returns the three new cells, or false if the edge between the two
+   *  opposite vertices already exists. The caller has to ensure that the
+   *  new cells are positively oriented.
+   */
+  template <class Elements>
+  bool flipAndGiveNewElements(const Cell_handle& c, int i,
+                              Elements& elements) {
+    const Vertex_handle u = c->vertex(i);
+    const Vertex_handle w = this->mirror_vertex(c, i);
+    if (!this->tds().flip(c, i)) return false;
+
+    incidentToEdge_(u, w, elements);
+    return true;
+  }
+
+  /** \brief 3-2 flip of the edge (c, i, j) with three incident cells
+   *
+   *  Returns the two new cells, or false if the facet spanned by the three
+   *  ring vertices already exists.
+   */
+  template <class Elements>
+  bool flipAndGiveNewElements(const Cell_handle& c, int i, int j,
+                              Elements& elements) {
+    const auto ring = ring_(c, i, j);
+    if (ring.size() != 3 || !this->tds().flip(c, i, j)) return false;
+
+    Cell_handle cell;
+    int i0, i1, i2;
+    this->is_facet(ring[0], ring[1], ring[2], cell, i0, i1, i2);
+    elements.push_back(cell);
+    elements.push_back(cell->neighbor(6 - i0 - i1 - i2));
+    return true;
+  }
+
+  /** \brief 4-4 flip of the edge (c, i, j) with four incident cells
+   *
+   *  The edge is replaced by the edge between the ring vertex diagonal and
+   *  the opposite ring vertex. This is a 2-3 flip followed by a 3-2 flip.
+   *  Returns the four new cells, or false if the flip is not possible
+   *  combinatorially.
+   */
+  template <class Elements>
+  bool flipAndGiveNewElements(const Cell_handle& c, int i, int j,
+                              const Vertex_handle& diagonal,
+                              Elements& elements) {
+    const Vertex_handle a = c->vertex(i), b = c->vertex(j);
+    const auto ring = ring_(c, i, j);
+    if (ring.size() != 4) return false;
+
+    int k = 0;
+    while (k < 4 && ring[k] != diagonal) ++k;
+    if (k == 4) return false;
+    const Vertex_handle opposite = ring[(k + 2) % 4];
+
+    // 2-3 flip of the facet (a, b, ring[k + 1]) creates the new edge
+    Cell_handle cell;
+    int ia, ib, ir;
+    this->is_facet(a, b, ring[(k + 1) % 4], cell, ia, ib, ir);
+    const int facet = 6 - ia - ib - ir;
+    if (!this->tds().flip(cell, facet)) return false;
+
+    // now, (a, b) has three incident cells
+    this->is_edge(a, b, cell, ia, ib);
+    if (!this->tds().flip(cell, ia, ib)) {
+      // undo the 2-3 flip
+      this->is_edge(diagonal, opposite, cell, ia, ib);
+      this->tds().flip(cell, ia, ib);
+      return false;
+    }
+
+    incidentToEdge_(diagonal, opposite, elements);
+    return true;
+  }
+
+ private:
+  //! Return the minimal mean ratio of the cells created by the collapse of v
+  //! onto w, zero if the collapse is not valid
+  double collapseQuality_(const Vertex_handle& v, const Vertex_handle& w,
+                          const std::vector<Cell_handle>& star) const {
+    Cell_handle c;
+    int i, j;
+    if (this->is_infinite(w) || !this->is_edge(v, w, c, i, j)) return 0.0;
+
+    // link condition: the common neighbors of v and w form the ring of (v, w)
+    const auto ring = ring_(c, i, j);
+    std::vector<Vertex_handle> adjacent;
+    this->finite_adjacent_vertices(v, std::back_inserter(adjacent));
+    for (const auto& x : adjacent)
+      if (x != w && this->is_edge(w, x, c, i, j) &&
+          std::find(ring.begin(), ring.end(), x) == ring.end())
+        return 0.0;
+
+    double quality = 1.0;
+    for (const auto& cell : star) {
+      if (cell->has_vertex(w)) continue;
+
+      // link condition: no facet (w, x, y) without the cell (v, w, x, y)
+      const int iv = cell->index(v);
+      for (int k = 0; k < 4; ++k) {
+        if (k == iv) continue;
+
+        std::array<Vertex_handle, 2> xy;
+        for (int l = 0, n = 0; l < 4; ++l)
+          if (l != iv && l != k) xy[n++] = cell->vertex(l);
+
+        Cell_handle d;
+        int i0, i1, i2, i3;
+        if (this->is_facet(w, xy[0], xy[1], d, i0, i1, i2) &&
+            !this->is_cell(v, w, xy[0], xy[1], d, i0, i1, i2, i3))
+          return 0.0;
+      }
+
+      std::array<Point, 4> p;
+      for (int k = 0; k < 4; ++k)
+        p[k] = (k == iv) ? w->point() : cell->vertex(k)->point();
+      if (this->geom_traits().orientation_3_object()(p[0], p[1], p[2], p[3]) !=
+          CGAL::POSITIVE)
+        return 0.0;
+
+      quality = std::min(quality, meanRatio_(p));
+    }
+    return quality;
+  }
+
+  //! Return the mean ratio of a tetrahedron, 1 for the regular tetrahedron
+  template <class Points>
+  static double meanRatio_(const Points& p) {
+    std::array<FieldVector<double, 3>, 4> x;
+    for (int k = 0; k < 4; ++k) x[k] = makeFieldVector(p[k]);
+
+    const auto a = x[1] - x[0], b = x[2] - x[0], c = x[3] - x[0];
+    const FieldVector<double, 3> n{b[1] * c[2] - b[2] * c[1],
+                                   b[2] * c[0] - b[0] * c[2],
+                                   b[0] * c[1] - b[1] * c[0]};
+    const double volume = (a * n) / 6.0;
+
+    double sum = 0.0;
+    for (int k = 0; k < 4; ++k)
+      for (int l = k + 1; l < 4; ++l) sum += (x[k] - x[l]).two_norm2();
+    return 12.0 * std::cbrt(9.0 * volume * volume) / sum;
+  }
+
+  //! Return the vertices around the edge (c, i, j) in circulation order
+  std::vector<Vertex_handle> ring_(const Cell_handle& c, int i, int j) const {
+    std::vector<Vertex_handle> ring;
+    auto fit = this->incident_facets(c, i, j);
+    const auto fend = fit;
+    do {
+      const Facet f = *fit;
+      for (int k = 0; k < 4; ++k)
+        if (k != f.second && f.first->vertex(k) != c->vertex(i) &&
+            f.first->vertex(k) != c->vertex(j))
+          ring.push_back(f.first->vertex(k));
+    } while (++fit != fend);
+    return ring;
+  }
+
+  //! Append the cells incident to the edge (u, w)
+  template <class Elements>
+  void incidentToEdge_(const Vertex_handle& u, const Vertex_handle& w,
+                       Elements& elements) const {
+    Cell_handle cell;
+    int iu, iw;
+    this->is_edge(u, w, cell, iu, iw);
+    auto cit = this->incident_cells(cell, iu, iw);
+    const auto cend = cit;
+    do
+      elements.push_back(cit);
+    while (++cit != cend);
   }
 };  // end of TriangulationWrapper<3>
 
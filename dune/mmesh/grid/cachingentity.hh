@@ -16,6 +16,7 @@
 #include <dune/mmesh/grid/multiid.hh>
 #include <dune/mmesh/grid/pointfieldvector.hh>
 #include <dune/mmesh/grid/polygoncutting.hh>
+#include <dune/mmesh/grid/tetrahedroncutting.hh>
 
 namespace Dune {
 
@@ -136,15 +137,8 @@ class MMeshCachingEntity<0, dim, GridImp>
   //! Return the number of subEntities of codimension cc
   unsigned int subEntities(unsigned int cc) const {
     // we have a simplex grid
-    int n = dim + 1;
-    int k = dim - cc + 1;
-
-    // binomial: n over k
-    int binomial = 1;
-    for (int i = n - k + 1; i <= n; i++) binomial *= i;
-    for (long i = 2; i <= k; i++) binomial /= i;
-
-    return binomial;
+    static constexpr auto sizes = MMeshImpl::simplexSubEntities<dim, 0>();
+    return sizes[cc];
   }
 
   //! returns true if Entity has no children
@@ -162,14 +156,23 @@ class MMeshCachingEntity<0, dim, GridImp>
     }
 
     using PC = Dune::PolygonCutting<ctype, GlobalCoordinate>;
-    return std::abs(
-        PC::polygonArea(PC::sutherlandHodgman(this->vertex_, entityPoints)));
+    typename PC::StaticPolygon points;
+    PC::sutherlandHodgman(this->vertex_, entityPoints, points);
+    return std::abs(PC::polygonArea(points));
   }
 
   template <int d = dim>
   std::enable_if_t<d == 3, ctype> intersectionVolume(
       const MMeshEntityType& entity) const {
-    DUNE_THROW(NotImplemented, "intersectionVolume in 3d");
+    std::array<GlobalCoordinate, 4> entityPoints;
+
+    for (int i = 0; i < 4; ++i) {
+      entityPoints[i] =
+          makeFieldVector(entity.impl().hostEntity()->vertex(i)->point());
+    }
+
+    using TC = Dune::TetrahedronCutting<ctype, GlobalCoordinate>;
+    return TC::intersectionVolume(this->vertex_, entityPoints);
   }
 
 };  // end of MMeshCachingEntity codim = 0
@@ -51,6 +51,59 @@ static inline auto& ref() {
   return ReferenceElements<ctype, dim>::simplex();
 }
 
+//! binomial coefficient n over k
+static constexpr unsigned int binomial(int n, int k) {
+  if (k < 0 || k > n) return 0;
+  unsigned int b = 1;
+  for (int i = 1; i <= k; ++i) b = b * (n - k + i) / i;
+  return b;
+}
+
+//! number of subentities of codimension cc (w.r.t. the grid) of a codim
+//! entity in a simplex grid of dimension dim
+template <int dim, int codim>
+static constexpr std::array<unsigned int, dim + 1> simplexSubEntities() {
+  std::array<unsigned int, dim + 1> sizes{};
+  for (int cc = 0; cc <= dim; ++cc)
+    sizes[cc] = binomial(dim - codim + 1, dim - cc + 1);
+  return sizes;
+}
+
+//! Sub-entity numbering of the DUNE reference simplex
+template <int dim>
+struct SimplexTables;
+
+template <>
+struct SimplexTables<2> {
+  //! vertices of the facets
+  static constexpr int facetVertices[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+};
+
+template <>
+struct SimplexTables<3> {
+  //! vertices of the facets
+  static constexpr int facetVertices[4][3] = {
+      {0, 1, 2}, {0, 1, 3}, {0, 2, 3}, {1, 2, 3}};
+
+  //! vertices of the edges
+  static constexpr int edgeVertices[6][2] = {{0, 1}, {0, 2}, {1, 2},
+                                             {0, 3}, {1, 3}, {2, 3}};
+
+  //! edge of two vertices
+  static constexpr int verticesEdge[4][4] = {
+      {-1, 0, 1, 3}, {0, -1, 2, 4}, {1, 2, -1, 5}, {3, 4, 5, -1}};
+};
+
+//! return the k-th vertex of subentity i of codimension cc of the reference
+//! simplex, i.e. ref<dim>().subEntity(i, cc, k, dim)
+template <int dim>
+static constexpr int refSubVertex(int i, int cc, int k) {
+  if (cc == 0) return k;
+  if (cc == dim) return i;
+  if (cc == 1) return SimplexTables<dim>::facetVertices[i][k];
+  return SimplexTables<3>::edgeVertices[i][k];
+}
+
 //! Return list of indices sorted by id
 template <typename HostEntity, int dim>
 static inline auto computeCGALIndices(const HostEntity& hostEntity) {
@@ -64,35 +117,31 @@ static inline auto computeCGALIndices(const HostEntity& hostEntity) {
   return indices;
 }
 
+//! Store the CGAL indices sorted by id and the inverse permutation in the
+//! info of a cell
+template <typename HostEntity, int dim>
+static inline void setCGALIndices(const HostEntity& hostEntity) {
+  auto& info = hostEntity->info();
+  const auto cgalIndex = computeCGALIndices<HostEntity, dim>(hostEntity);
+  for (std::size_t k = 0; k < dim + 1; ++k) {
+    info.cgalIndex[k] = cgalIndex[k];
+    info.duneIndex[cgalIndex[k]] = k;
+  }
+}
+
 // for a given dune facet index compute corresponding CGAL .second value
-template <std::size_t dim>
-static inline std::size_t duneFacetToCgalSecond(
-    const std::size_t duneFacet,
-    const std::array<std::size_t, dim + 1>& cgalIndex) {
-  std::size_t sum = 0;
-  for (std::size_t k = 0; k < dim; ++k)
-    sum += cgalIndex[ref<dim>().subEntity(duneFacet, 1, k, dim)];
-
-  static constexpr int max = (dim == 2) ? 3 : 6;
-  return max - sum;
+template <std::size_t dim, class CGALIndex>
+static inline std::size_t duneFacetToCgalSecond(const std::size_t duneFacet,
+                                                const CGALIndex& cgalIndex) {
+  // dune facet i is opposite to dune vertex dim-i
+  return cgalIndex[dim - duneFacet];
 }
 
 // for a given CGAL .second value compute corresponding dune facet index
 template <std::size_t dim, typename HostFacet>
 static inline std::size_t cgalFacetToDuneFacet(const HostFacet& facet) {
-  const auto& i = facet.second;
-  const auto& cgalIndex = facet.first->info().cgalIndex;
-
-  // invert cgalIndex
-  auto duneIndex = cgalIndex;
-  for (std::size_t k = 0; k < dim + 1; ++k) duneIndex[cgalIndex[k]] = k;
-
-  std::size_t sum = 0;
-  for (std::size_t k = 0; k < dim; ++k)
-    sum += duneIndex[(i + k + 1) % (dim + 1)];
-
-  static const int thr = (dim == 2) ? 1 : 3;
-  return sum - thr;
+  // CGAL facet i is opposite to CGAL vertex i
+  return dim - facet.first->info().duneIndex[facet.second];
 }
 
 template <std::size_t dim, typename HostEdge>
@@ -101,21 +150,14 @@ static inline std::size_t cgalEdgeToDuneEdge(const HostEdge& cgalEdge) {
   const auto& i = cgalEdge.second;
   const auto& j = cgalEdge.third;
 
-  const auto& cgalIndex = c->info().cgalIndex;
-
-  // invert cgalIndex
-  auto duneIndex = cgalIndex;
-  for (std::size_t k = 0; k < dim + 1; ++k) duneIndex[cgalIndex[k]] = k;
-
-  auto i0 = duneIndex[i];
-  auto j0 = duneIndex[j];
-
-  if (i0 > j0) std::swap(i0, j0);
+  const auto& duneIndex = c->info().duneIndex;
+  return SimplexTables<3>::verticesEdge[duneIndex[i]][duneIndex[j]];
+}
 
-  if (j0 != 3)
-    return i0 + j0 - 1;
-  else
-    return 3 + i0;
+//! return the local edge number (0,...,5) of the CGAL edge (i, j) in a cell
+static inline std::size_t cgalEdgeIndex(std::size_t i, std::size_t j) {
+  if (i > j) std::swap(i, j);
+  return i + j - (i == 0 ? 1 : 0);
 }
 
 }  // namespace MMeshImpl
@@ -7,10 +7,12 @@
  * \brief The MMeshConnectedComponent class
  */
 
+#include <cstdint>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 // MMesh includes
+#include <dune/mmesh/grid/memoryusage.hh>
 #include <dune/mmesh/grid/multiid.hh>
 
 namespace Dune {
@@ -26,7 +28,8 @@ class MMeshCachingEntity;
 /** \brief The implementation of a connected component of entities in MMesh
  *   \ingroup MMesh
  *  The connected component stores a list of connected entities providing
- * geometrical information for the remeshing step.
+ * geometrical information for the remeshing step. The grid keeps the
+ * components and their storage across adaptation cycles and only resets them.
  *
  */
 template <class GridImp>
@@ -47,89 +50,93 @@ class MMeshConnectedComponent {
   using IdType = MMeshImpl::MultiId;
 
  public:
-  MMeshConnectedComponent() : componentNumber_(0) {}
+  //! Flags of the elements during the construction of the components
+  static constexpr std::uint8_t pending = 1;
+  static constexpr std::uint8_t gathered = 2;
 
-  MMeshConnectedComponent(const GridImp* mMesh, const Entity& entity)
-      : mMesh_(mMesh),
-        componentNumber_(entity.impl().hostEntity()->info().componentNumber) {
-    entities_.emplace_back(mMesh_, entity.impl().hostEntity());
-    CachingEntity& cachingEntity = entities_.back();
-
-    const IdType id = mMesh_->globalIdSet().id(entity);
-    entityIdToCachingPtr_.insert(std::make_pair(id, &cachingEntity));
+  MMeshConnectedComponent() : mMesh_(nullptr), componentNumber_(0) {}
 
-    insertNeighbors_(entity, cachingEntity);
+  //! Start an empty component, the storage of the entities is kept
+  void reset(const GridImp* mMesh, std::size_t componentNumber) {
+    mMesh_ = mMesh;
+    componentNumber_ = componentNumber;
+    entities_.clear();
   }
 
-  MMeshConnectedComponent& operator=(const MMeshConnectedComponent& other) {
-    // check for self-assignment
-    if (&other == this) return *this;
-
-    entities_ = other.entities_;
-    entityIdToCachingPtr_ = other.entityIdToCachingPtr_;
-    mMesh_ = other.mMesh_;
-    componentNumber_ = other.componentNumber_;
-
-    return *this;
+  //! Remove all entities, the storage of the entities is kept
+  void clear() {
+    componentNumber_ = 0;
+    entities_.clear();
   }
 
-  void update(const Entity& entity) {
+  /** \brief Add entity and all might vanishing elements connected to it
+   *
+   *  \param entity  An element with the number of this component
+   *  \param state   Flags by leaf index, only elements flagged as pending are
+   *                 added and flagged as gathered
+   */
+  void update(const Entity& entity, std::vector<std::uint8_t>& state) {
+    state[mMesh_->leafIndexSet().index(entity)] = gathered;
     entities_.emplace_back(mMesh_, entity.impl().hostEntity());
-    CachingEntity& cachingEntity = entities_.back();
-
-    const IdType id = mMesh_->globalIdSet().id(entity);
-    entityIdToCachingPtr_.insert(std::make_pair(id, &cachingEntity));
-
-    insertNeighbors_(entity, cachingEntity);
+    insertNeighbors_(entity, state);
   }
 
-  const std::list<CachingEntity>& entities() const { return entities_; }
+  const std::vector<CachingEntity>& entities() const { return entities_; }
 
   //! Return list of caching entities in this component
-  const std::list<CachingEntity>& children() const { return entities(); }
+  const std::vector<CachingEntity>& children() const { return entities(); }
 
   //! Return number of caching entities in this component
   const std::size_t size() const { return entities_.size(); }
 
   bool hasEntity(const Entity& entity) const {
-    const IdType& id = mMesh_->globalIdSet().id(entity);
-    return (entityIdToCachingPtr_.find(id) != entityIdToCachingPtr_.end());
+    for (const auto& cachingEntity : entities_)
+      if (cachingEntity == entity) return true;
+    return false;
   }
 
   std::size_t componentNumber() const { return componentNumber_; }
 
+  //! Return the number of bytes allocated by this component
+  std::size_t memoryUsage() const {
+    return MMeshImpl::memoryUsage(entities_) + MMeshImpl::memoryUsage(stack_);
+  }
+
  private:
-  /** \brief Insert all might vanishing neighbors of entity into entities_
-   * recursively. */
-  void insertNeighbors_(const Entity& entity, CachingEntity& cachingEntity) {
-    for (const auto& intersection :
-         intersections(mMesh_->leafGridView(), entity))
-      if (intersection.neighbor()) {
-        const Entity& neighbor = intersection.outside();
-        if (neighbor.impl().hostEntity()->info().componentNumber ==
-                componentNumber_ &&
-            !neighbor.isNew()) {
-          const IdType id = mMesh_->globalIdSet().id(neighbor);
-
-          const auto& it = entityIdToCachingPtr_.find(id);
-
-          // if not found, add neighbor and start recursion
-          if (it == entityIdToCachingPtr_.end()) {
-            entities_.emplace_back(mMesh_, neighbor.impl().hostEntity());
-            CachingEntity& cachingNeighbor = entities_.back();
-
-            entityIdToCachingPtr_.insert(std::make_pair(id, &cachingNeighbor));
-
-            insertNeighbors_(neighbor, cachingNeighbor);
+  /** \brief Insert all pending elements that are connected to entity into
+   * entities_. The search uses an explicit stack to bound the memory
+   * independently of the size of the component. */
+  void insertNeighbors_(const Entity& entity,
+                        std::vector<std::uint8_t>& state) {
+    stack_.clear();
+    stack_.push_back(entity);
+    while (!stack_.empty()) {
+      const Entity current = stack_.back();
+      stack_.pop_back();
+
+      for (const auto& intersection :
+           intersections(mMesh_->leafGridView(), current))
+        if (intersection.neighbor()) {
+          const Entity& neighbor = intersection.outside();
+          if (neighbor.impl().hostEntity()->info().componentNumber ==
+                  componentNumber_ &&
+              !neighbor.isNew()) {
+            std::uint8_t& flag = state[mMesh_->leafIndexSet().index(neighbor)];
+
+            // if pending, add neighbor and continue the search from it
+            if (flag == pending) {
+              flag = gathered;
+              entities_.emplace_back(mMesh_, neighbor.impl().hostEntity());
+              stack_.push_back(neighbor);
+            }
           }
         }
-      }
+    }
   }
 
   //! The entities of the connected component
-  //! Note: we use a list here as we will share pointers to these entities
-  std::list<CachingEntity> entities_;
-  std::unordered_map<IdType, CachingEntity*> entityIdToCachingPtr_;
+  std::vector<CachingEntity> entities_;
+  std::vector<Entity> stack_;
 
   //! pointer to the grid implementation
   const GridImp* mMesh_;
@@ -6,11 +6,17 @@
 /** \file
  * \brief The CutSetTriangulation class
  * This class computes the overlapping polytope of to intersecting triangles
- * and returns a retriangulation of this domain as temporary entities.
+ * (2d) or tetrahedra (3d) and returns a retriangulation of this domain as
+ * temporary entities.
  */
 
+#include <array>
+#include <cmath>
+#include <vector>
+
 #include <dune/mmesh/grid/pointfieldvector.hh>
 #include <dune/mmesh/grid/polygoncutting.hh>
+#include <dune/mmesh/grid/tetrahedroncutting.hh>
 
 namespace Dune {
 
@@ -28,36 +34,63 @@ class CutSetTriangulation {
       MMeshCachingEntity<0, dim, const typename EntityImpl::Grid>;
 
  public:
+  //! The corners of a triangle (2d) or tetrahedron (3d) of the cut set
+  using Simplex = std::array<GlobalCoordinate, dim + 1>;
+
   CutSetTriangulation(const CachingEntity& caching, const Entity& element) {
-    static_assert(dim == 2);
+    compute(caching, element, [&](const Simplex& simplex) {
+      triangles_.emplace_back(EntityImpl(&element.impl().grid(), simplex));
+    });
+  }
 
+  /** \brief Call f(simplex) for every simplex of the cut set
+   *
+   *  The cut set is clipped in fixed-capacity polygons (2d) or lists of
+   *  tetrahedra (3d), such that no memory is allocated.
+   */
+  template <class F>
+  static void compute(const CachingEntity& caching, const Entity& element,
+                      const F& f) {
     const auto& cgeo = caching.geometry();
     const auto& host = element.impl().hostEntity();
 
-    std::array<GlobalCoordinate, 3> c, e;
+    Simplex c, e;
 
-    for (int i = 0; i < 3; ++i) {
+    for (int i = 0; i < dim + 1; ++i) {
       c[i] = cgeo.corner(i);
-      // obtain vertices in ccw order
+      // in 2d, the host vertices are in ccw order
       e[i] = makeFieldVector(host->vertex(i)->point());
     }
 
-    // check orientation of caching entity
-    int o = (c[1][1] - c[0][1]) * (c[2][0] - c[1][0]) -
-            (c[1][0] - c[0][0]) * (c[2][1] - c[1][1]);
-    if (o > 0)  // clock wise
-      std::swap(c[1], c[2]);
-
-    using PC = Dune::PolygonCutting<ctype, GlobalCoordinate>;
-    auto points = PC::sutherlandHodgman(c, e);
-
-    if (points.size() < 3) return;
-
-    // we know the intersection polygon of two triangles is convex
-    for (std::size_t i = 1; i < points.size() - 1; ++i) {
-      EntityImpl entity(&element.impl().grid(),
-                        {points[0], points[i], points[i + 1]});
-      if (entity.geometry().volume() > 1e-8) triangles_.emplace_back(entity);
+    if constexpr (dim == 2) {
+      // check orientation of caching entity
+      const ctype o = (c[1][1] - c[0][1]) * (c[2][0] - c[1][0]) -
+                      (c[1][0] - c[0][0]) * (c[2][1] - c[1][1]);
+      if (o > 0)  // clock wise
+        std::swap(c[1], c[2]);
+
+      using PC = Dune::PolygonCutting<ctype, GlobalCoordinate>;
+      typename PC::StaticPolygon points;
+      PC::sutherlandHodgman(c, e, points);
+
+      if (points.size() < 3) return;
+
+      // we know the intersection polygon of two triangles is convex
+      for (std::size_t i = 1; i < points.size() - 1; ++i) {
+        const GlobalCoordinate a = points[i] - points[0];
+        const GlobalCoordinate b = points[i + 1] - points[0];
+        if (0.5 * std::abs(a[0] * b[1] - a[1] * b[0]) > 1e-8)
+          f(Simplex{points[0], points[i], points[i + 1]});
+      }
+    } else {
+      using TC = Dune::TetrahedronCutting<ctype, GlobalCoordinate>;
+      typename TC::StaticTetrahedra tetrahedra;
+      TC::clip(c, e, tetrahedra);
+
+      // skip slivers relative to the size of the element
+      const ctype minVolume = 1e-8 * TC::volume(e);
+      for (const auto& t : tetrahedra)
+        if (TC::volume(t) > minVolume) f(t);
     }
   }
 
@@ -167,15 +167,8 @@ class MMeshEntity
   //! Return the number of subEntities of codimension codim
   unsigned int subEntities(unsigned int cc) const {
     // we have a simplex grid
-    int n = dim - codim + 1;
-    int k = dim - cc + 1;
-
-    // binomial: n over k
-    int binomial = 1;
-    for (int i = n - k + 1; i <= n; i++) binomial *= i;
-    for (long i = 2; i <= k; i++) binomial /= i;
-
-    return binomial;
+    static constexpr auto sizes = MMeshImpl::simplexSubEntities<dim, codim>();
+    return sizes[cc];
   }
 
   //! Obtain a cc dim subEntity of a codim 1 entity
@@ -187,8 +180,7 @@ class MMeshEntity
     const auto& cell = hostEntity_.first;
     auto facetIdx =
         MMeshImpl::cgalFacetToDuneFacet<dim, HostGridEntity>(hostEntity_);
-    const auto i0 =
-        cgalIndex(MMeshImpl::ref<dim>().subEntity(facetIdx, 1, i, dim));
+    const auto i0 = cgalIndex(MMeshImpl::refSubVertex<dim>(facetIdx, 1, i));
 
     return MMeshEntity<cc, dim, GridImp>(
         mMesh_,
@@ -206,8 +198,7 @@ class MMeshEntity
     auto edgeIdx =
         MMeshImpl::cgalEdgeToDuneEdge<3, HostGridEntity>(hostEntity_);
 
-    const auto i0 =
-        cgalIndex(MMeshImpl::ref<dim>().subEntity(edgeIdx, 2, i, 3));
+    const auto i0 = cgalIndex(MMeshImpl::refSubVertex<dim>(edgeIdx, 2, i));
 
     return MMeshEntity<cc, dim, GridImp>(
         mMesh_,
@@ -350,7 +341,7 @@ class MMeshEntity
   IdType id() const {
     // cache id
     if (id_ == IdType()) {
-      typename IdType::VT idlist(dim + 1 - codim);
+      std::array<typename IdType::T, dim + 1 - codim> idlist;
       for (std::size_t i = 0; i < this->subEntities(dim); ++i)
         idlist[i] =
             this->template subEntity<dim>(i).impl().hostEntity()->info().id;
@@ -564,9 +555,12 @@ class MMeshEntity<0, dim, GridImp>
 
   //! Geometry of this entity
   Geometry geometry() const {
-    if (isLeaf_)
+    if (isLeaf_) {
+      if (mMesh_ && mMesh_->geometryCache().valid())
+        return Geometry(
+            mMesh_->geometryCache().geometry(hostEntity_->info().index));
       return Geometry(hostEntity_);
-    else
+    } else
       return Geometry(this->vertex_);
   }
 
@@ -575,27 +569,24 @@ class MMeshEntity<0, dim, GridImp>
   //! Geometry of this entity in bounded father entity ( assumption: this
   //! \subset father )
   LocalGeometry geometryInFather() const {
-    if constexpr (dim != 2)
-      DUNE_THROW(NotImplemented, "geometryInFather() for dim != 2");
-    else {
-      assert(father_ != nullptr);
+    assert(father_ != nullptr);
 
-      auto thisPoints = this->vertex_;
+    auto thisPoints = this->vertex_;
 
-      if (isLeaf_)
-        for (int i = 0; i < 3; ++i) thisPoints[i] = geometry().corner(i);
+    if (isLeaf_)
+      for (int i = 0; i < dim + 1; ++i) thisPoints[i] = geometry().corner(i);
 
-      std::array<GlobalCoordinate, 3> local;
-      for (int i = 0; i < 3; ++i)
-        local[i] = father_->impl().geometry().local(thisPoints[i]);
+    std::array<GlobalCoordinate, dim + 1> local;
+    for (int i = 0; i < dim + 1; ++i)
+      local[i] = father_->impl().geometry().local(thisPoints[i]);
 
-      return LocalGeometry(local);
-    }
+    return LocalGeometry(local);
   }
 
   //! Return the number of subEntities of codimension cc
   unsigned int subEntities(unsigned int cc) const {
-    return MMeshImpl::ref<dim>().size(cc);
+    static constexpr auto sizes = MMeshImpl::simplexSubEntities<dim, 0>();
+    return sizes[cc];
   }
 
   /** \brief Provide access to sub entity i of given codimension. Entities
@@ -638,8 +629,8 @@ class MMeshEntity<0, dim, GridImp>
   subEntity(unsigned int i) const {
     assert(i < subEntities(cc));
 
-    const auto i0 = cgalIndex(MMeshImpl::ref<dim>().subEntity(i, 2, 0, 3));
-    const auto i1 = cgalIndex(MMeshImpl::ref<dim>().subEntity(i, 2, 1, 3));
+    const auto i0 = cgalIndex(MMeshImpl::refSubVertex<dim>(i, 2, 0));
+    const auto i1 = cgalIndex(MMeshImpl::refSubVertex<dim>(i, 2, 1));
 
     return MMeshEntity<cc, dim, GridImp>(
         mMesh_,
@@ -703,7 +694,7 @@ class MMeshEntity<0, dim, GridImp>
   IdType id() const {
     // cache id
     if (id_ == IdType()) {
-      typename IdType::VT idlist(dim + 1);
+      std::array<typename IdType::T, dim + 1> idlist;
       for (std::size_t i = 0; i < this->subEntities(dim); ++i)
         idlist[i] = hostEntity_->vertex(i)->info().id;
       std::sort(idlist.begin(), idlist.end());
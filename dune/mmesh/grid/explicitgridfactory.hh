@@ -417,7 +417,7 @@ class MMeshExplicitGridFactory : public GridFactoryInterface<Grid> {
 
     // Mark interface vertices as isInterface
     for (const auto& interfaceSeg : interfaceSegments_)
-      for (const auto& v : interfaceSeg.first.vt())
+      for (const auto& v : interfaceSeg.first)
         vhs_[v]->info().isInterface = true;
 
     // Check if all inserted elements really exist in the triangulation
@@ -52,7 +52,8 @@ class MMeshGeometry<md, 2, GridImp>
   MMeshGeometry(const typename GridImp::template HostGridEntity<0>& hostEntity)
       : BaseType(GeometryTypes::simplex(mydim), getVertices(hostEntity)) {}
 
-  MMeshGeometry(const std::array<FVector, 3> points)
+  //! Constructor from the corners
+  MMeshGeometry(const std::array<FVector, mydim + 1>& points)
       : BaseType(GeometryTypes::simplex(mydim), points) {}
 
   //! Constructor from host geometry with codim 1
@@ -96,8 +97,7 @@ class MMeshGeometry<md, 2, GridImp>
     for (int k = 0; k < 2; ++k)
       vertices[k] = makeFieldVector(
           hostEntity.first
-              ->vertex(
-                  cgalIdx[MMeshImpl::ref<2>().subEntity(facetIdx, 1, k, 2)])
+              ->vertex(cgalIdx[MMeshImpl::refSubVertex<2>(facetIdx, 1, k)])
               ->point());
 
     return vertices;
@@ -139,7 +139,8 @@ class MMeshGeometry<md, 3, GridImp>
   MMeshGeometry(const typename GridImp::template HostGridEntity<0>& hostEntity)
       : BaseType(GeometryTypes::simplex(mydim), getVertices<0>(hostEntity)) {}
 
-  MMeshGeometry(const std::array<FVector, 4> points)
+  //! Constructor from the corners
+  MMeshGeometry(const std::array<FVector, mydim + 1>& points)
       : BaseType(GeometryTypes::simplex(mydim), points) {}
 
   //! Constructor from host geometry with codim 1
@@ -187,8 +188,7 @@ class MMeshGeometry<md, 3, GridImp>
     std::array<FVector, 3> vertices;
     for (int i = 0; i < 3; ++i)
       vertices[i] = makeFieldVector(
-          cell->vertex(
-                  cgalIdx[MMeshImpl::ref<3>().subEntity(facetIdx, 1, i, 3)])
+          cell->vertex(cgalIdx[MMeshImpl::refSubVertex<3>(facetIdx, 1, i)])
               ->point());
     return vertices;
   }
@@ -204,10 +204,10 @@ class MMeshGeometry<md, 3, GridImp>
 
     std::array<FVector, 2> vertices;
     vertices[0] = makeFieldVector(
-        cell->vertex(cgalIdx[MMeshImpl::ref<3>().subEntity(edgeIdx, 2, 0, 3)])
+        cell->vertex(cgalIdx[MMeshImpl::refSubVertex<3>(edgeIdx, 2, 0)])
             ->point());
     vertices[1] = makeFieldVector(
-        cell->vertex(cgalIdx[MMeshImpl::ref<3>().subEntity(edgeIdx, 2, 1, 3)])
+        cell->vertex(cgalIdx[MMeshImpl::refSubVertex<3>(edgeIdx, 2, 1)])
             ->point());
 
     return vertices;
@@ -0,0 +1,247 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_MMESH_GRID_GEOMETRYCACHE_HH
+#define DUNE_MMESH_GRID_GEOMETRYCACHE_HH
+
+/** \file
+ * \brief The MMeshGeometryCache class
+ */
+
+#include <array>
+#include <vector>
+
+// Dune includes
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/grid/common/partitionset.hh>
+
+// MMesh includes
+#include <dune/mmesh/grid/geometry.hh>
+#include <dune/mmesh/grid/memoryusage.hh>
+#include <dune/mmesh/grid/pointfieldvector.hh>
+
+namespace Dune {
+
+/** \brief Cache of the element geometries of an MMesh
+ *  \ingroup MMesh
+ *
+ *  The cache stores the corners and the integration outer normals of the
+ *  facets of all elements as structure of arrays, and the geometries of all
+ *  elements and their facets, i.e. with their transposed Jacobian inverses
+ *  and integration elements. Everything is indexed by the leaf index of the
+ *  element and the facets are numbered by the DUNE reference element.
+ *  Element and intersection geometries are copies of the cached ones.
+ *
+ *  The grid fills the cache by update() after the topology has been changed
+ *  and refreshes the cells incident to moved vertices by update(cells).
+ */
+template <class Grid>
+class MMeshGeometryCache {
+ public:
+  static constexpr int dim = Grid::dimension;
+
+  using ctype = typename Grid::ctype;
+  using GlobalCoordinate = FieldVector<ctype, dim>;
+  using LocalCoordinate = FieldVector<ctype, dim>;
+  using JacobianInverseTransposed = FieldMatrix<ctype, dim, dim>;
+  using ElementGeometry = MMeshGeometry<dim, dim, const Grid>;
+  using FacetGeometry = MMeshGeometry<dim - 1, dim, const Grid>;
+
+  explicit MMeshGeometryCache(const Grid& grid) : grid_(grid) {}
+
+  //! Fill the cache for the current grid
+  void update() {
+    // the geometries must not be taken from the cache while it is filled
+    valid_ = false;
+    const auto& indexSet = grid_.leafIndexSet();
+    size_ = indexSet.size(0);
+    resize_();
+
+    for (const auto& element :
+         elements(grid_.leafGridView(), Partitions::all)) {
+      const std::size_t i = indexSet.index(element);
+      gatherCorners_(i, element.impl().hostEntity());
+      computeElement_(i);
+    }
+
+    valid_ = true;
+  }
+
+  //! Refresh the given host cells after their vertices have been moved
+  template <class HostCells>
+  void update(const HostCells& cells) {
+    if (!valid_) return;
+    for (const auto& hostEntity : cells) {
+      const std::size_t i = hostEntity->info().index;
+      gatherCorners_(i, hostEntity);
+      computeElement_(i);
+    }
+  }
+
+  //! Release the storage and mark the cache as invalid
+  void clear() {
+    size_ = 0;
+    resize_();
+    valid_ = false;
+  }
+
+  //! Mark the cache as invalid
+  void invalidate() { valid_ = false; }
+
+  //! Return if the cache is up to date
+  bool valid() const { return valid_; }
+
+  //! Return the number of cached elements
+  std::size_t size() const { return size_; }
+
+  //! Return the number of bytes used by the cached arrays
+  std::size_t memoryUsage() const {
+    using MMeshImpl::memoryUsage;
+    return memoryUsage(corners_) + memoryUsage(normals_) +
+           memoryUsage(geometries_) + memoryUsage(facetGeometries_);
+  }
+
+  //! Return the k-th corner of element i
+  GlobalCoordinate corner(std::size_t i, int k) const {
+    GlobalCoordinate x;
+    for (int c = 0; c < dim; ++c) x[c] = corners_[k * dim + c][i];
+    return x;
+  }
+
+  //! Return the corners of element i
+  std::array<GlobalCoordinate, dim + 1> corners(std::size_t i) const {
+    std::array<GlobalCoordinate, dim + 1> x;
+    for (int k = 0; k < dim + 1; ++k) x[k] = corner(i, k);
+    return x;
+  }
+
+  //! Return the geometry of element i
+  const ElementGeometry& geometry(std::size_t i) const {
+    return geometries_[i];
+  }
+
+  //! Return the geometry of facet j of element i
+  const FacetGeometry& facetGeometry(std::size_t i, int j) const {
+    return facetGeometries_[i][j];
+  }
+
+  //! Return the transposed inverse of the Jacobian of element i
+  const JacobianInverseTransposed& jacobianInverseTransposed(
+      std::size_t i) const {
+    return geometries_[i].jacobianInverseTransposed(LocalCoordinate(0.0));
+  }
+
+  //! Return the integration element of element i
+  ctype integrationElement(std::size_t i) const {
+    return geometries_[i].integrationElement(LocalCoordinate(0.0));
+  }
+
+  //! Return the volume of element i
+  ctype volume(std::size_t i) const { return geometries_[i].volume(); }
+
+  //! Return the integration outer normal of facet j of element i
+  GlobalCoordinate integrationOuterNormal(std::size_t i, int j) const {
+    GlobalCoordinate n;
+    for (int c = 0; c < dim; ++c) n[c] = normals_[j * dim + c][i];
+    return n;
+  }
+
+  //! Return the volume of facet j of element i
+  ctype facetVolume(std::size_t i, int j) const {
+    return facetGeometries_[i][j].volume();
+  }
+
+ private:
+  //! Copy the corners of a host cell to the arrays of element i
+  template <class HostEntity>
+  void gatherCorners_(std::size_t i, const HostEntity& hostEntity) {
+    const auto& cgalIdx = hostEntity->info().cgalIndex;
+    for (int k = 0; k < dim + 1; ++k) {
+      const auto x = makeFieldVector(hostEntity->vertex(cgalIdx[k])->point());
+      for (int c = 0; c < dim; ++c) corners_[k * dim + c][i] = x[c];
+    }
+  }
+
+  //! Compute the geometries and normals of element i from its corners
+  void computeElement_(std::size_t i) {
+    const auto x = corners(i);
+    geometries_[i] = ElementGeometry(x);
+    for (int j = 0; j < dim + 1; ++j) {
+      std::array<GlobalCoordinate, dim> y;
+      for (int k = 0; k < dim; ++k)
+        y[k] = x[MMeshImpl::refSubVertex<dim>(j, 1, k)];
+      facetGeometries_[i][j] = FacetGeometry(y);
+    }
+
+    // J[c][k] = d x_c / d xi_k
+    ctype J[dim][dim];
+    for (int k = 0; k < dim; ++k)
+      for (int c = 0; c < dim; ++c)
+        J[c][k] = corners_[(k + 1) * dim + c][i] - corners_[c][i];
+
+    // adjugate of J, i.e. det(J) J^{-1}
+    ctype adj[dim][dim];
+    ctype det;
+    if constexpr (dim == 2) {
+      det = J[0][0] * J[1][1] - J[0][1] * J[1][0];
+      adj[0][0] = J[1][1];
+      adj[0][1] = -J[0][1];
+      adj[1][0] = -J[1][0];
+      adj[1][1] = J[0][0];
+    } else {
+      for (int r = 0; r < 3; ++r)
+        for (int c = 0; c < 3; ++c) {
+          const int r1 = (c + 1) % 3, r2 = (c + 2) % 3;
+          const int c1 = (r + 1) % 3, c2 = (r + 2) % 3;
+          adj[r][c] = J[r1][c1] * J[r2][c2] - J[r1][c2] * J[r2][c1];
+        }
+      det = J[0][0] * adj[0][0] + J[0][1] * adj[1][0] + J[0][2] * adj[2][0];
+    }
+
+    // The outer normal of the facet opposite to vertex v is -grad(lambda_v),
+    // scaled by |det J| its length is the integration element of the facet
+    const ctype sign = (det > 0) ? -1.0 : 1.0;
+    for (int j = 0; j < dim + 1; ++j) {
+      const int v = dim - j;
+
+      ctype n[dim];
+      for (int c = 0; c < dim; ++c) {
+        // adj^T times the reference gradient of lambda_v
+        if (v == 0) {
+          n[c] = 0.0;
+          for (int k = 0; k < dim; ++k) n[c] -= adj[k][c];
+        } else
+          n[c] = adj[v - 1][c];
+      }
+
+      for (int c = 0; c < dim; ++c) normals_[j * dim + c][i] = sign * n[c];
+    }
+  }
+
+  void resize_() {
+    for (auto& v : corners_) v.resize(size_);
+    for (auto& v : normals_) v.resize(size_);
+    geometries_.resize(size_);
+    facetGeometries_.resize(size_);
+
+    if (size_ == 0) {
+      for (auto& v : corners_) v.shrink_to_fit();
+      for (auto& v : normals_) v.shrink_to_fit();
+      geometries_.shrink_to_fit();
+      facetGeometries_.shrink_to_fit();
+    }
+  }
+
+  const Grid& grid_;
+  std::size_t size_ = 0;
+  bool valid_ = false;
+
+  std::array<std::vector<ctype>, (dim + 1) * dim> corners_;
+  std::array<std::vector<ctype>, (dim + 1) * dim> normals_;
+  std::vector<ElementGeometry> geometries_;
+  std::vector<std::array<FacetGeometry, dim + 1>> facetGeometries_;
+};
+
+}  // namespace Dune
+
+#endif
@@ -10,7 +10,129 @@
 // Dune includes
 #include <dune/grid/common/gridenums.hh>
 
+// MMesh includes
+#include <dune/mmesh/misc/smallvector.hh>
+
 namespace Dune {
+
+namespace MMeshImpl {
+
+//! Number of handles of a vertex star that are stored without allocation
+static constexpr std::size_t starCapacity = 64;
+
+/** \brief Walk once around a circulator and skip the rejected entries
+ *
+ *  A default constructed circulation is the end of every circulation.
+ */
+template <class Circulator>
+class StarCirculation {
+ public:
+  StarCirculation() = default;
+
+  template <class Accept>
+  StarCirculation(const Circulator& circulator, const Accept& accept)
+      : circulator_(circulator),
+        begin_(circulator),
+        done_(circulator == nullptr) {
+    if (!done_) skip_(accept);
+  }
+
+  //! Move to the next accepted entry
+  template <class Accept>
+  void increment(const Accept& accept) {
+    ++circulator_;
+    if (circulator_ == begin_)
+      done_ = true;
+    else
+      skip_(accept);
+  }
+
+  //! Return the current position
+  const Circulator& circulator() const { return circulator_; }
+
+  //! equality
+  bool equals(const StarCirculation& other) const {
+    return done_ == other.done_ && (done_ || circulator_ == other.circulator_);
+  }
+
+ private:
+  template <class Accept>
+  void skip_(const Accept& accept) {
+    while (!accept(circulator_)) {
+      ++circulator_;
+      if (circulator_ == begin_) {
+        done_ = true;
+        return;
+      }
+    }
+  }
+
+  Circulator circulator_;
+  Circulator begin_;
+  bool done_ = true;
+};
+
+//! The inline storage of the cells incident to a vertex
+template <class HostGrid>
+using StarCells =
+    MMeshSmallVector<typename HostGrid::Cell_handle, starCapacity>;
+
+//! Collect all (also infinite) cells incident to a vertex of a 3d
+//! triangulation by walking over the facets containing the vertex
+template <class VertexHandle, class Cells>
+void incidentCells(const VertexHandle& vh, Cells& cells) {
+  cells.clear();
+  cells.push_back(vh->cell());
+  for (std::size_t n = 0; n < cells.size(); ++n) {
+    const auto c = cells[n];
+    const int iv = c->index(vh);
+    for (int i = 0; i < 4; ++i)
+      if (i != iv) {
+        const auto nb = c->neighbor(i);
+        if (!cells.contains(nb)) cells.push_back(nb);
+      }
+  }
+}
+
+//! Collect the accepted vertices adjacent to a vertex of a 3d triangulation
+template <class VertexHandle, class Vertices, class Accept>
+void incidentVertices(const VertexHandle& vh, Vertices& vertices,
+                      const Accept& accept) {
+  MMeshSmallVector<decltype(vh->cell()), starCapacity> cells;
+  incidentCells(vh, cells);
+
+  vertices.clear();
+  for (const auto& c : cells)
+    for (int k = 0; k < 4; ++k) {
+      const auto w = c->vertex(k);
+      if (w != vh && !vertices.contains(w) && accept(w)) vertices.push_back(w);
+    }
+}
+
+/** \brief Advance (n, i) to the next accepted finite facet (cells[n], i)
+ *         incident to vh
+ *
+ *  Every facet is visited once and is represented by a finite cell.
+ */
+template <class HostGrid, class VertexHandle, class Cells, class Accept>
+void nextIncidentFacet(const HostGrid& hostgrid, const VertexHandle& vh,
+                       const Cells& cells, std::size_t& n, int& i,
+                       const Accept& accept) {
+  for (; n < cells.size(); ++n, i = 0) {
+    const auto& c = cells[n];
+    if (hostgrid.is_infinite(c)) continue;
+
+    for (; i < 4; ++i) {
+      if (c->vertex(i) == vh) continue;
+
+      const auto& nb = c->neighbor(i);
+      if ((hostgrid.is_infinite(nb) || c < nb) && accept(c, i)) return;
+    }
+  }
+}
+
+}  // namespace MMeshImpl
+
 //! Forward declaration
 template <class GridImp, int dim>
 class MMeshIncidentIteratorImp;
@@ -64,7 +186,8 @@ class MMeshIncidentIteratorImp<GridImp, 2> {
   typedef typename GridImp::template HostGridEntity<0> HostGridEntity;
 
   //! The type of the element circulator
-  using ElementContainer = std::vector<HostGridEntity>;
+  using Circulator = typename GridImp::HostGridType::Face_circulator;
+  using Circulation = MMeshImpl::StarCirculation<Circulator>;
 
  public:
   enum { codimension = 0 };
@@ -73,13 +196,9 @@ class MMeshIncidentIteratorImp<GridImp, 2> {
 
   explicit MMeshIncidentIteratorImp(const GridImp* mMesh,
                                     const HostGridVertex& hostEntity)
-      : mMesh_(mMesh), i_(0) {
-    auto circulator = mMesh->getHostGrid().incident_faces(hostEntity);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         ++i, ++circulator)
-      if (!mMesh->getHostGrid().is_infinite(circulator))
-        elementContainer_.push_back(circulator);
-  }
+      : mMesh_(mMesh),
+        circulation_(mMesh->getHostGrid().incident_faces(hostEntity),
+                     accept()) {}
 
   /** \brief Constructor which creates the end iterator
    *  \param endDummy      Here only to distinguish it from the other
@@ -88,28 +207,30 @@ class MMeshIncidentIteratorImp<GridImp, 2> {
   explicit MMeshIncidentIteratorImp(const GridImp* mMesh,
                                     const HostGridVertex& hostEntity,
                                     bool endDummy)
-      : mMesh_(mMesh), i_(0) {
-    auto circulator = mMesh->getHostGrid().incident_faces(hostEntity);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         ++i, ++circulator)
-      if (!mMesh->getHostGrid().is_infinite(circulator)) ++i_;
-  }
+      : mMesh_(mMesh) {}
 
   //! prefix increment
-  void increment() { ++i_; }
+  void increment() { circulation_.increment(accept()); }
 
   //! dereferencing
-  Entity dereference() const { return Entity{{mMesh_, elementContainer_[i_]}}; }
+  Entity dereference() const {
+    return Entity{{mMesh_, HostGridEntity(circulation_.circulator())}};
+  }
 
   //! equality
   bool equals(const MMeshIncidentIteratorImp& iter) const {
-    return i_ == iter.i_;
+    return circulation_.equals(iter.circulation_);
   }
 
  private:
+  auto accept() const {
+    return [this](const Circulator& c) {
+      return !mMesh_->getHostGrid().is_infinite(c);
+    };
+  }
+
   const GridImp* mMesh_;
-  ElementContainer elementContainer_;
-  std::size_t i_;
+  Circulation circulation_;
 };
 
 //! 3D
@@ -121,11 +242,8 @@ class MMeshIncidentIteratorImp<GridImp, 3> {
       HostGridVertex;
   typedef typename GridImp::template HostGridEntity<0> HostGridEntity;
 
-  //! The type of the element output
-  using ElementOutput = typename GridImp::ElementOutput;
-
-  //! The type of the element container
-  using ElementContainer = std::vector<HostGridEntity>;
+  //! The type of the star of the vertex
+  using Cells = MMeshImpl::StarCells<typename GridImp::HostGridType>;
 
  public:
   enum { codimension = 0 };
@@ -134,14 +252,9 @@ class MMeshIncidentIteratorImp<GridImp, 3> {
 
   explicit MMeshIncidentIteratorImp(const GridImp* mMesh,
                                     const HostGridVertex& hostEntity)
-      : mMesh_(mMesh), i_(0) {
-    ElementOutput elements;
-    mMesh_->getHostGrid().finite_incident_cells(hostEntity,
-                                                std::back_inserter(elements));
-
-    typename ElementOutput::iterator fit;
-    for (fit = elements.begin(); fit != elements.end(); fit++)
-      elementContainer_.push_back(*fit);
+      : mMesh_(mMesh), n_(0) {
+    MMeshImpl::incidentCells(hostEntity, cells_);
+    skip_();
   }
 
   /** \brief Constructor which creates the end iterator
@@ -151,30 +264,32 @@ class MMeshIncidentIteratorImp<GridImp, 3> {
   explicit MMeshIncidentIteratorImp(const GridImp* mMesh,
                                     const HostGridVertex& hostEntity,
                                     bool endDummy)
-      : mMesh_(mMesh), i_(0) {
-    ElementOutput elements;
-    mMesh_->getHostGrid().finite_incident_cells(hostEntity,
-                                                std::back_inserter(elements));
-
-    typename ElementOutput::iterator fit;
-    for (fit = elements.begin(); fit != elements.end(); fit++) ++i_;
-  }
+      : mMesh_(mMesh), n_(0) {}
 
   //! prefix increment
-  void increment() { ++i_; }
+  void increment() {
+    ++n_;
+    skip_();
+  }
 
   //! dereferencing
-  Entity dereference() const { return Entity{{mMesh_, elementContainer_[i_]}}; }
+  Entity dereference() const { return Entity{{mMesh_, cells_[n_]}}; }
 
   //! equality
   bool equals(const MMeshIncidentIteratorImp& iter) const {
-    return i_ == iter.i_;
+    return atEnd_() == iter.atEnd_() && (atEnd_() || n_ == iter.n_);
   }
 
  private:
+  bool atEnd_() const { return n_ >= cells_.size(); }
+
+  void skip_() {
+    while (!atEnd_() && mMesh_->getHostGrid().is_infinite(cells_[n_])) ++n_;
+  }
+
   const GridImp* mMesh_;
-  ElementContainer elementContainer_;
-  std::size_t i_;
+  Cells cells_;
+  std::size_t n_;
 };
 
 //! 3D
@@ -188,7 +303,7 @@ class MMeshEdgeIncidentIteratorImp<GridImp, 3> {
 
   //! The type of the element circulator
   using Circulator = typename GridImp::HostGridType::Cell_circulator;
-  using ElementContainer = std::vector<HostGridEntity>;
+  using Circulation = MMeshImpl::StarCirculation<Circulator>;
 
  public:
   enum { codimension = 0 };
@@ -197,13 +312,9 @@ class MMeshEdgeIncidentIteratorImp<GridImp, 3> {
 
   explicit MMeshEdgeIncidentIteratorImp(const GridImp* mMesh,
                                         const HostGridEdge& hostEntity)
-      : mMesh_(mMesh), i_(0) {
-    Circulator circulator = mMesh_->getHostGrid().incident_cells(hostEntity);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         circulator++, i++)
-      if (!mMesh->getHostGrid().is_infinite(circulator))
-        elementContainer_.push_back(circulator);
-  }
+      : mMesh_(mMesh),
+        circulation_(mMesh->getHostGrid().incident_cells(hostEntity),
+                     accept()) {}
 
   /** \brief Constructor which creates the end iterator
    *  \param endDummy      Here only to distinguish it from the other
@@ -212,28 +323,30 @@ class MMeshEdgeIncidentIteratorImp<GridImp, 3> {
   explicit MMeshEdgeIncidentIteratorImp(const GridImp* mMesh,
                                         const HostGridEdge& hostEntity,
                                         bool endDummy)
-      : mMesh_(mMesh), i_(0) {
-    Circulator circulator = mMesh_->getHostGrid().incident_cells(hostEntity);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         circulator++, i++)
-      if (!mMesh->getHostGrid().is_infinite(circulator)) ++i_;
-  }
+      : mMesh_(mMesh) {}
 
   //! prefix increment
-  void increment() { ++i_; }
+  void increment() { circulation_.increment(accept()); }
 
   //! dereferencing
-  Entity dereference() const { return Entity{{mMesh_, elementContainer_[i_]}}; }
+  Entity dereference() const {
+    return Entity{{mMesh_, HostGridEntity(circulation_.circulator())}};
+  }
 
   //! equality
   bool equals(const MMeshEdgeIncidentIteratorImp& iter) const {
-    return i_ == iter.i_;
+    return circulation_.equals(iter.circulation_);
   }
 
  private:
+  auto accept() const {
+    return [this](const Circulator& c) {
+      return !mMesh_->getHostGrid().is_infinite(c);
+    };
+  }
+
   const GridImp* mMesh_;
-  ElementContainer elementContainer_;
-  std::size_t i_;
+  Circulation circulation_;
 };
 
 /** \brief Iterator over all incident facets
@@ -251,7 +364,7 @@ class MMeshIncidentFacetsIteratorImp<GridImp, 2> {
 
   //! The type of the element circulator
   using Circulator = typename GridImp::HostGridType::Edge_circulator;
-  using ElementContainer = std::vector<HostGridEntity>;
+  using Circulation = MMeshImpl::StarCirculation<Circulator>;
 
  public:
   enum { codimension = 1 };
@@ -260,13 +373,9 @@ class MMeshIncidentFacetsIteratorImp<GridImp, 2> {
 
   explicit MMeshIncidentFacetsIteratorImp(const GridImp* mMesh,
                                           const HostGridVertex& hostEntity)
-      : mMesh_(mMesh), i_(0) {
-    Circulator circulator = mMesh->getHostGrid().incident_edges(hostEntity);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         ++i, ++circulator)
-      if (!mMesh->getHostGrid().is_infinite(circulator))
-        elementContainer_.push_back(*circulator);
-  }
+      : mMesh_(mMesh),
+        circulation_(mMesh->getHostGrid().incident_edges(hostEntity),
+                     accept()) {}
 
   /** \brief Constructor which creates the end iterator
    *  \param endDummy      Here only to distinguish it from the other
@@ -275,28 +384,30 @@ class MMeshIncidentFacetsIteratorImp<GridImp, 2> {
   explicit MMeshIncidentFacetsIteratorImp(const GridImp* mMesh,
                                           const HostGridVertex& hostEntity,
                                           bool endDummy)
-      : mMesh_(mMesh), i_(0) {
-    Circulator circulator = mMesh->getHostGrid().incident_edges(hostEntity);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         ++i, ++circulator)
-      if (!mMesh->getHostGrid().is_infinite(circulator)) ++i_;
-  }
+      : mMesh_(mMesh) {}
 
   //! prefix increment
-  void increment() { ++i_; }
+  void increment() { circulation_.increment(accept()); }
 
   //! dereferencing
-  Entity dereference() const { return Entity{{mMesh_, elementContainer_[i_]}}; }
+  Entity dereference() const {
+    return Entity{{mMesh_, HostGridEntity(*circulation_.circulator())}};
+  }
 
   //! equality
   bool equals(const MMeshIncidentFacetsIteratorImp& iter) const {
-    return i_ == iter.i_;
+    return circulation_.equals(iter.circulation_);
   }
 
  private:
+  auto accept() const {
+    return [this](const Circulator& c) {
+      return !mMesh_->getHostGrid().is_infinite(c);
+    };
+  }
+
   const GridImp* mMesh_;
-  ElementContainer elementContainer_;
-  std::size_t i_;
+  Circulation circulation_;
 };
 
 //! 3D
@@ -308,11 +419,8 @@ class MMeshIncidentFacetsIteratorImp<GridImp, 3> {
       HostGridVertex;
   typedef typename GridImp::template HostGridEntity<1> HostGridEntity;
 
-  //! The type of the element output
-  using ElementOutput = typename GridImp::BoundaryEdgesOutput;
-
-  //! The type of the element container
-  using ElementContainer = std::vector<HostGridEntity>;
+  //! The type of the star of the vertex
+  using Cells = MMeshImpl::StarCells<typename GridImp::HostGridType>;
 
  public:
   enum { codimension = 1 };
@@ -321,14 +429,9 @@ class MMeshIncidentFacetsIteratorImp<GridImp, 3> {
 
   explicit MMeshIncidentFacetsIteratorImp(const GridImp* mMesh,
                                           const HostGridVertex& hostEntity)
-      : mMesh_(mMesh), i_(0) {
-    ElementOutput elements;
-    mMesh_->getHostGrid().finite_incident_facets(hostEntity,
-                                                 std::back_inserter(elements));
-
-    typename ElementOutput::iterator fit;
-    for (fit = elements.begin(); fit != elements.end(); fit++)
-      elementContainer_.push_back(*fit);
+      : mMesh_(mMesh), hostEntity_(hostEntity), n_(0), i_(0) {
+    MMeshImpl::incidentCells(hostEntity, cells_);
+    skip_();
   }
 
   /** \brief Constructor which creates the end iterator
@@ -338,30 +441,38 @@ class MMeshIncidentFacetsIteratorImp<GridImp, 3> {
   explicit MMeshIncidentFacetsIteratorImp(const GridImp* mMesh,
                                           const HostGridVertex& hostEntity,
                                           bool endDummy)
-      : mMesh_(mMesh), i_(0) {
-    ElementOutput elements;
-    mMesh_->getHostGrid().finite_incident_facets(hostEntity,
-                                                 std::back_inserter(elements));
-
-    typename ElementOutput::iterator fit;
-    for (fit = elements.begin(); fit != elements.end(); fit++) ++i_;
-  }
+      : mMesh_(mMesh), hostEntity_(hostEntity), n_(0), i_(0) {}
 
   //! prefix increment
-  void increment() { ++i_; }
+  void increment() {
+    ++i_;
+    skip_();
+  }
 
   //! dereferencing
-  Entity dereference() const { return Entity{{mMesh_, elementContainer_[i_]}}; }
+  Entity dereference() const {
+    return Entity{{mMesh_, HostGridEntity(cells_[n_], i_)}};
+  }
 
   //! equality
   bool equals(const MMeshIncidentFacetsIteratorImp& iter) const {
-    return i_ == iter.i_;
+    return atEnd_() == iter.atEnd_() &&
+           (atEnd_() || (n_ == iter.n_ && i_ == iter.i_));
   }
 
  private:
+  bool atEnd_() const { return n_ >= cells_.size(); }
+
+  void skip_() {
+    MMeshImpl::nextIncidentFacet(mMesh_->getHostGrid(), hostEntity_, cells_,
+                                 n_, i_, [](const auto&, int) { return true; });
+  }
+
   const GridImp* mMesh_;
-  ElementContainer elementContainer_;
-  std::size_t i_;
+  HostGridVertex hostEntity_;
+  Cells cells_;
+  std::size_t n_;
+  int i_;
 };
 
 /** \brief Iterator over all incident vertices
@@ -377,7 +488,7 @@ class MMeshIncidentVerticesIteratorImp<GridImp, 2> {
 
   //! The type of the element circulator
   using Circulator = typename GridImp::HostGridType::Vertex_circulator;
-  using ElementContainer = std::vector<HostGridVertex>;
+  using Circulation = MMeshImpl::StarCirculation<Circulator>;
 
  public:
   enum { codimension = GridImp::dimension };
@@ -387,13 +498,10 @@ class MMeshIncidentVerticesIteratorImp<GridImp, 2> {
   explicit MMeshIncidentVerticesIteratorImp(const GridImp* mMesh,
                                             const HostGridVertex& hostEntity,
                                             bool includeInfinite)
-      : mMesh_(mMesh), i_(0) {
-    Circulator circulator = mMesh->getHostGrid().incident_vertices(hostEntity);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         ++i, ++circulator)
-      if (includeInfinite || !mMesh->getHostGrid().is_infinite(circulator))
-        elementContainer_.push_back(circulator);
-  }
+      : mMesh_(mMesh),
+        includeInfinite_(includeInfinite),
+        circulation_(mMesh->getHostGrid().incident_vertices(hostEntity),
+                     accept()) {}
 
   /** \brief Constructor which creates the end iterator
    *  \param endDummy      Here only to distinguish it from the other
@@ -402,29 +510,31 @@ class MMeshIncidentVerticesIteratorImp<GridImp, 2> {
   explicit MMeshIncidentVerticesIteratorImp(const GridImp* mMesh,
                                             const HostGridVertex& hostEntity,
                                             bool includeInfinite, bool endDummy)
-      : mMesh_(mMesh), i_(0) {
-    Circulator circulator = mMesh->getHostGrid().incident_vertices(hostEntity);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         ++i, ++circulator)
-      if (includeInfinite || !mMesh->getHostGrid().is_infinite(circulator))
-        ++i_;
-  }
+      : mMesh_(mMesh), includeInfinite_(includeInfinite) {}
 
   //! prefix increment
-  void increment() { ++i_; }
+  void increment() { circulation_.increment(accept()); }
 
   //! dereferencing
-  Entity dereference() const { return Entity{{mMesh_, elementContainer_[i_]}}; }
+  Entity dereference() const {
+    return Entity{{mMesh_, HostGridVertex(circulation_.circulator())}};
+  }
 
   //! equality
   bool equals(const MMeshIncidentVerticesIteratorImp& iter) const {
-    return i_ == iter.i_;
+    return circulation_.equals(iter.circulation_);
   }
 
  private:
+  auto accept() const {
+    return [this](const Circulator& c) {
+      return includeInfinite_ || !mMesh_->getHostGrid().is_infinite(c);
+    };
+  }
+
   const GridImp* mMesh_;
-  ElementContainer elementContainer_;
-  std::size_t i_;
+  bool includeInfinite_;
+  Circulation circulation_;
 };
 
 //! 3D
@@ -434,11 +544,8 @@ class MMeshIncidentVerticesIteratorImp<GridImp, 3> {
   //! The type of the requested vertex entity
   typedef typename GridImp::VertexHandle HostGridVertex;
 
-  //! The type of the element output
-  using ElementOutput = std::list<HostGridVertex>;
-
-  //! The type of the element container
-  using ElementContainer = std::vector<HostGridVertex>;
+  //! The type of the vertex container
+  using Vertices = MMeshSmallVector<HostGridVertex, MMeshImpl::starCapacity>;
 
  public:
   enum { codimension = GridImp::dimension };
@@ -449,14 +556,11 @@ class MMeshIncidentVerticesIteratorImp<GridImp, 3> {
                                             const HostGridVertex& hostEntity,
                                             bool includeInfinite)
       : mMesh_(mMesh), i_(0) {
-    ElementOutput elements;
-    mMesh_->getHostGrid().incident_vertices(hostEntity,
-                                            std::back_inserter(elements));
-
-    typename ElementOutput::iterator fit;
-    for (fit = elements.begin(); fit != elements.end(); fit++)
-      if (includeInfinite || !mMesh->getHostGrid().is_infinite(*fit))
-        elementContainer_.push_back(*fit);
+    const auto& hostgrid = mMesh_->getHostGrid();
+    MMeshImpl::incidentVertices(
+        hostEntity, vertices_, [&](const HostGridVertex& vh) {
+          return includeInfinite || !hostgrid.is_infinite(vh);
+        });
   }
 
   /** \brief Constructor which creates the end iterator
@@ -466,30 +570,24 @@ class MMeshIncidentVerticesIteratorImp<GridImp, 3> {
   explicit MMeshIncidentVerticesIteratorImp(const GridImp* mMesh,
                                             const HostGridVertex& hostEntity,
                                             bool includeInfinite, bool endDummy)
-      : mMesh_(mMesh), i_(0) {
-    ElementOutput elements;
-    mMesh_->getHostGrid().incident_vertices(hostEntity,
-                                            std::back_inserter(elements));
-
-    typename ElementOutput::iterator fit;
-    for (fit = elements.begin(); fit != elements.end(); fit++)
-      if (includeInfinite || !mMesh->getHostGrid().is_infinite(*fit)) ++i_;
-  }
+      : mMesh_(mMesh), i_(0) {}
 
   //! prefix increment
   void increment() { ++i_; }
 
   //! dereferencing
-  Entity dereference() const { return Entity{{mMesh_, elementContainer_[i_]}}; }
+  Entity dereference() const { return Entity{{mMesh_, vertices_[i_]}}; }
 
   //! equality
   bool equals(const MMeshIncidentVerticesIteratorImp& iter) const {
-    return i_ == iter.i_;
+    return atEnd_() == iter.atEnd_() && (atEnd_() || i_ == iter.i_);
   }
 
  private:
+  bool atEnd_() const { return i_ >= vertices_.size(); }
+
   const GridImp* mMesh_;
-  ElementContainer elementContainer_;
+  Vertices vertices_;
   std::size_t i_;
 };
 
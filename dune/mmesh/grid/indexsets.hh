@@ -7,9 +7,20 @@
  * \brief The index and id sets for the MMesh class
  */
 
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 // Dune includes
+#include <dune/grid/common/exceptions.hh>
 #include <dune/grid/common/indexidset.hh>
+#include <dune/mmesh/grid/memoryusage.hh>
 #include <dune/mmesh/grid/multiid.hh>
+#include <dune/mmesh/grid/pointfieldvector.hh>
+#include <dune/mmesh/grid/spacefillingcurve.hh>
 
 namespace Dune {
 
@@ -24,8 +35,6 @@ class MMeshLeafIndexSet : public IndexSet<GridImp, MMeshLeafIndexSet<GridImp>> {
   typedef std::size_t IndexType;
   typedef const std::vector<GeometryType> Types;
 
-  typedef std::unordered_map<MMeshImpl::MultiId, std::size_t> CodimIndexMap;
-
   /*
    * We use the remove_const to extract the Type from the mutable class,
    * because the const class is not instantiated yet.
@@ -52,22 +61,22 @@ class MMeshLeafIndexSet : public IndexSet<GridImp, MMeshLeafIndexSet<GridImp>> {
   template <int codim>
   std::enable_if_t<codim == 1, IndexType> index(
       const Entity<codim, dim, GridImp, MMeshEntity>& e) const {
-    try {
-      return codimIndexMap_[0].at(grid_->globalIdSet().id(e));
-    } catch (...) {
-      DUNE_THROW(InvalidStateException, "Id of codim 1 entity not found.");
-    }
+    const auto& hostEntity = e.impl().hostEntity();
+    IndexType index = hostEntity.first->info().facetIndex[hostEntity.second];
+    assert(index < size(codim));
+    return index;
   }
 
   //! get index of an codim 2 entity
   template <int codim>
   std::enable_if_t<codim == 2 && dim == 3, IndexType> index(
       const Entity<codim, dim, GridImp, MMeshEntity>& e) const {
-    try {
-      return codimIndexMap_[1].at(grid_->globalIdSet().id(e));
-    } catch (...) {
-      DUNE_THROW(InvalidStateException, "Id of codim 2 entity not found.");
-    }
+    const auto& hostEntity = e.impl().hostEntity();
+    const std::size_t k =
+        MMeshImpl::cgalEdgeIndex(hostEntity.second, hostEntity.third);
+    IndexType index = hostEntity.first->info().edgeIndex[k];
+    assert(index < size(codim));
+    return index;
   }
 
   //! get subIndex of subEntity i with given codim of an entity
@@ -95,20 +104,19 @@ class MMeshLeafIndexSet : public IndexSet<GridImp, MMeshLeafIndexSet<GridImp>> {
     assert(codim >= 0 && codim <= dim);
 
     if (codim == 0) return index(e);
-    if (codim == dim)
-      return e.impl()
-          .template subEntity<dim>(i)
-          .impl()
-          .hostEntity()
-          ->info()
-          .index;
-    else if (codim == 1)
-      return codimIndexMap_[0].at(
-          grid_->globalIdSet().id(e.impl().template subEntity<1>(i)));
-    else if (codim == 2)
-      return codimIndexMap_[1].at(
-          grid_->globalIdSet().id(e.impl().template subEntity<2>(i)));
-    else
+    if (codim == dim) {
+      const auto& hostEntity = e.impl().hostEntity();
+      return hostEntity->vertex(hostEntity->info().cgalIndex[i])->info().index;
+    } else if (codim == 1) {
+      const auto& info = e.impl().hostEntity()->info();
+      return info.facetIndex[MMeshImpl::duneFacetToCgalSecond<dim>(
+          i, info.cgalIndex)];
+    } else if (codim == 2) {
+      const auto& info = e.impl().hostEntity()->info();
+      const auto i0 = info.cgalIndex[MMeshImpl::refSubVertex<dim>(i, 2, 0)];
+      const auto i1 = info.cgalIndex[MMeshImpl::refSubVertex<dim>(i, 2, 1)];
+      return info.edgeIndex[MMeshImpl::cgalEdgeIndex(i0, i1)];
+    } else
       DUNE_THROW(InvalidStateException,
                  "subIndex() was called for codim " << codim);
 
@@ -232,68 +240,540 @@ class MMeshLeafIndexSet : public IndexSet<GridImp, MMeshLeafIndexSet<GridImp>> {
   template <int d = dim>
   std::enable_if_t<d == 2, void> update(const GridImp* grid) {
     grid_ = grid;
-    const auto& hostgrid = grid_->getHostGrid();
+
+    clearHandles_();
 
     // Store face indices within face infos
     std::size_t elementCount = 0;
-    for (const auto& element : elements(grid_->leafGridView(), Partitions::all))
+    for (const auto& element :
+         elements(grid_->leafGridView(), Partitions::all)) {
       element.impl().hostEntity()->info().index = elementCount++;
+      if (incremental_) elementHandles_.push_back(element.impl().hostEntity());
+    }
 
     // Store vertex indices within vertex infos
     std::size_t vertexCount = 0;
-    for (const auto& vertex : vertices(grid_->leafGridView(), Partitions::all))
+    for (const auto& vertex :
+         vertices(grid_->leafGridView(), Partitions::all)) {
       vertex.impl().hostEntity()->info().index = vertexCount++;
+      if (incremental_) vertexHandles_.push_back(vertex.impl().hostEntity());
+    }
 
-    // Store the finite edge indices in a map
-    codimIndexMap_[0].clear();
+    // Store the finite edge indices within the infos of both adjacent faces
     std::size_t edgeCount = 0;
-    for (const auto& edge : edges(grid_->leafGridView(), Partitions::all))
-      codimIndexMap_[0][grid_->globalIdSet().id(edge)] = edgeCount++;
+    for (const auto& edge : edges(grid_->leafGridView(), Partitions::all)) {
+      setFacetIndex_(edge.impl().hostEntity(), edgeCount++);
+      if (incremental_) facetHandles_.push_back(edge.impl().hostEntity());
+    }
 
     // Cache sizes since it is expensive to compute them
     sizeOfCodim_[0] = elementCount;
     sizeOfCodim_[1] = edgeCount;
     sizeOfCodim_[2] = vertexCount;
+    for (int codim = 0; codim <= dim; ++codim) checkSize_(codim);
+
+    if (ordering_ != MMeshOrdering::none) order_();
   }
 
   //! update index set in 3d
   template <int d = dim>
   std::enable_if_t<d == 3, void> update(const GridImp* grid) {
     grid_ = grid;
-    const auto& hostgrid = grid_->getHostGrid();
+
+    clearHandles_();
 
     // Store cell indices within cell infos
     std::size_t elementCount = 0;
-    for (const auto& element : elements(grid_->leafGridView(), Partitions::all))
+    for (const auto& element :
+         elements(grid_->leafGridView(), Partitions::all)) {
       element.impl().hostEntity()->info().index = elementCount++;
+      if (incremental_) elementHandles_.push_back(element.impl().hostEntity());
+    }
 
     // Store vertex indices within vertex infos
     std::size_t vertexCount = 0;
-    for (const auto& vertex : vertices(grid_->leafGridView(), Partitions::all))
+    for (const auto& vertex :
+         vertices(grid_->leafGridView(), Partitions::all)) {
       vertex.impl().hostEntity()->info().index = vertexCount++;
+      if (incremental_) vertexHandles_.push_back(vertex.impl().hostEntity());
+    }
 
-    // Store the finite facet indices in a map
-    codimIndexMap_[0].clear();
+    // Store the finite facet indices within the infos of both adjacent cells
     std::size_t facetCount = 0;
-    for (const auto& facet : facets(grid_->leafGridView(), Partitions::all))
-      codimIndexMap_[0][grid_->globalIdSet().id(facet)] = facetCount++;
+    for (const auto& facet : facets(grid_->leafGridView(), Partitions::all)) {
+      setFacetIndex_(facet.impl().hostEntity(), facetCount++);
+      if (incremental_) facetHandles_.push_back(facet.impl().hostEntity());
+    }
 
-    // Store the finite edge indices in a map
-    codimIndexMap_[1].clear();
+    // Store the finite edge indices within the infos of all incident cells
     std::size_t edgeCount = 0;
-    for (const auto& edge : edges(grid_->leafGridView(), Partitions::all))
-      codimIndexMap_[1][grid_->globalIdSet().id(edge)] = edgeCount++;
+    for (const auto& edge : edges(grid_->leafGridView(), Partitions::all)) {
+      setEdgeIndex_(edge.impl().hostEntity(), edgeCount++);
+      if (incremental_) edgeHandles_.push_back(edge.impl().hostEntity());
+    }
 
     // Cache sizes since it is expensive to compute them
     sizeOfCodim_[0] = elementCount;
     sizeOfCodim_[1] = facetCount;
     sizeOfCodim_[2] = edgeCount;
     sizeOfCodim_[3] = vertexCount;
+    for (int codim = 0; codim <= dim; ++codim) checkSize_(codim);
+
+    if (ordering_ != MMeshOrdering::none) order_();
+  }
+
+  /** \brief Set the numbering of the elements and vertices
+   *
+   *  If an ordering other than MMeshOrdering::none is set, update() numbers
+   *  the elements by the position of their barycenters and the vertices by
+   *  their position along the space-filling curve. Facets and edges are
+   *  numbered in the order they are first visited by the elements. Local
+   *  updates keep the numbering, it is restored by the next update().
+   */
+  void setOrdering(MMeshOrdering ordering) { ordering_ = ordering; }
+
+  //! Return the numbering of the elements and vertices
+  MMeshOrdering ordering() const { return ordering_; }
+
+  //! Return the number of bytes used by the incremental bookkeeping, the
+  //! indices themselves are stored in the host entities
+  std::size_t memoryUsage() const {
+    using MMeshImpl::memoryUsage;
+    return memoryUsage(elementHandles_) + memoryUsage(vertexHandles_) +
+           memoryUsage(facetHandles_) + memoryUsage(edgeHandles_) +
+           memoryUsage(freeIndices_) + memoryUsage(released_) +
+           memoryUsage(vanishing_) + memoryUsage(ring_) +
+           memoryUsage(changedElements_);
+  }
+
+  /** \brief Enable the incremental update of the index set
+   *
+   *  If enabled, the index set stores the host entity of every index such
+   *  that the indices can be updated locally by beginUpdate(), endUpdate()
+   *  and compress(). The handles are set up in the next call of update().
+   */
+  void setIncremental(bool incremental) { incremental_ = incremental; }
+
+  //! Return if the index set is updated incrementally
+  bool incremental() const { return incremental_; }
+
+  /** \brief Prepare a local change of the host grid
+   *
+   *  \param cells all host cells (including infinite ones) that vanish
+   *  \param vh    the vertex that vanishes (if any)
+   *
+   *  Collects the indices of the entities inside the conflict region and
+   *  the boundary of the conflict region. Must be followed by endUpdate()
+   *  or cancelUpdate().
+   */
+  template <class Cells>
+  void beginUpdate(const Cells& cells,
+                   const HostGridEntity<dim>& vh = HostGridEntity<dim>()) {
+    assert(incremental_);
+    const auto& hostgrid = grid_->getHostGrid();
+
+    vanishing_.assign(cells.begin(), cells.end());
+    std::sort(vanishing_.begin(), vanishing_.end());
+    ring_.clear();
+    for (auto& released : released_) released.clear();
+
+    for (const auto& c : vanishing_) {
+      if (!hostgrid.is_infinite(c)) released_[0].push_back(c->info().index);
+
+      for (int i = 0; i < dim + 1; ++i) {
+        const HostGridEntity<0> n = c->neighbor(i);
+        if (!contains_(vanishing_, n))
+          ring_.emplace_back(n, n->index(c));
+        else if (c < n && !hostgrid.is_infinite(c, i))
+          released_[1].push_back(c->info().facetIndex[i]);
+      }
+
+      // edges vanish if all incident cells vanish
+      if constexpr (dim == 3)
+        for (int i = 0; i < dim; ++i)
+          for (int j = i + 1; j < dim + 1; ++j) {
+            if (hostgrid.is_infinite(c, i, j)) continue;
+
+            bool vanishes = true, first = true;
+            auto cit = hostgrid.incident_cells(c, i, j);
+            const auto cend = cit;
+            do {
+              const HostGridEntity<0> other = cit;
+              vanishes &= contains_(vanishing_, other);
+              first &= !(other < c);
+            } while (++cit != cend && vanishes);
+
+            if (vanishes && first)
+              released_[2].push_back(
+                  c->info().edgeIndex[MMeshImpl::cgalEdgeIndex(i, j)]);
+          }
+    }
+
+    if (vh != HostGridEntity<dim>())
+      released_[dim].push_back(vh->info().index);
+  }
+
+  /** \brief Finish a local change of the host grid
+   *
+   *  \param vh the vertex that has been created (if any)
+   *
+   *  The new cells are found by a flood fill starting at the boundary of the
+   *  conflict region. Indices of vanished entities are reused for the new
+   *  ones. The vertex ids of all vertices of the new cells have to be set.
+   *
+   *  \return false if the new cells could not be determined and a full
+   *  update() is required
+   */
+  bool endUpdate(const HostGridEntity<dim>& vh = HostGridEntity<dim>()) {
+    assert(incremental_);
+    if (ring_.empty()) return false;
+
+    const auto& hostgrid = grid_->getHostGrid();
+
+    // collect the new cells, these are enclosed by the surviving cells
+    std::vector<HostGridEntity<0>> survivors;
+    survivors.reserve(ring_.size());
+    for (const auto& facet : ring_) survivors.push_back(facet.first);
+    std::sort(survivors.begin(), survivors.end());
+
+    // a set of visited cells keeps the flood fill in O(n log n)
+    std::set<HostGridEntity<0>> visited;
+    std::vector<HostGridEntity<0>> stack;
+    for (const auto& facet : ring_)
+      stack.push_back(facet.first->neighbor(facet.second));
+
+    while (!stack.empty()) {
+      const HostGridEntity<0> c = stack.back();
+      stack.pop_back();
+      if (!visited.insert(c).second) continue;
+
+      for (int i = 0; i < dim + 1; ++i) {
+        const HostGridEntity<0> n = c->neighbor(i);
+        if (!contains_(survivors, n) && !visited.count(n)) stack.push_back(n);
+      }
+    }
+    const std::vector<HostGridEntity<0>> created(visited.begin(),
+                                                 visited.end());
+
+    // the indices of vanished entities can be reused
+    for (int codim = 0; codim <= dim; ++codim)
+      freeIndices_[codim].insert(freeIndices_[codim].end(),
+                                 released_[codim].begin(),
+                                 released_[codim].end());
+
+    if (vh != HostGridEntity<dim>())
+      vh->info().index = insertIndex_(dim, vertexHandles_, vh);
+
+    for (const auto& c : created) {
+      MMeshImpl::setCGALIndices<HostGridEntity<0>, dim>(c);
+
+      if (!hostgrid.is_infinite(c)) {
+        c->info().index = insertIndex_(0, elementHandles_, c);
+        changedElements_.push_back(c->info().index);
+      }
+
+      // facets are either shared with a surviving cell or new
+      for (int i = 0; i < dim + 1; ++i) {
+        if (hostgrid.is_infinite(c, i)) continue;
+
+        const HostGridEntity<0> n = c->neighbor(i);
+        const HostGridEntity<1> facet(c, i);
+        if (!contains_(created, n)) {
+          const std::size_t index = n->info().facetIndex[n->index(c)];
+          c->info().facetIndex[i] = index;
+          facetHandles_[index] = facet;
+        } else if (c < n)
+          setFacetIndex_(facet, insertIndex_(1, facetHandles_, facet));
+      }
+
+      // edges are either shared with a surviving cell or new
+      if constexpr (dim == 3)
+        for (int i = 0; i < dim; ++i)
+          for (int j = i + 1; j < dim + 1; ++j) {
+            if (hostgrid.is_infinite(c, i, j)) continue;
+
+            HostGridEntity<0> old;
+            bool first = true;
+            auto cit = hostgrid.incident_cells(c, i, j);
+            const auto cend = cit;
+            do {
+              const HostGridEntity<0> other = cit;
+              if (!contains_(created, other))
+                old = other;
+              else
+                first &= !(other < c);
+            } while (++cit != cend);
+
+            if (!first) continue;
+
+            const HostGridEntity<2> edge(c, i, j);
+            std::size_t index;
+            if (old != HostGridEntity<0>()) {
+              const auto v0 = c->vertex(i);
+              const auto v1 = c->vertex(j);
+              index = old->info().edgeIndex[MMeshImpl::cgalEdgeIndex(
+                  old->index(v0), old->index(v1))];
+              edgeHandles_[index] = edge;
+            } else
+              index = insertIndex_(2, edgeHandles_, edge);
+            setEdgeIndex_(edge, index);
+          }
+    }
+
+    vanishing_.clear();
+    ring_.clear();
+    return true;
+  }
+
+  //! Discard a local change prepared by beginUpdate()
+  void cancelUpdate() {
+    vanishing_.clear();
+    ring_.clear();
+  }
+
+  //! Close the gaps in the index ranges after local updates
+  void compress() {
+    assert(incremental_);
+    compress_(0, elementHandles_, [this](const auto& c, std::size_t index) {
+      c->info().index = index;
+      changedElements_.push_back(index);
+    });
+    compress_(dim, vertexHandles_, [](const auto& v, std::size_t index) {
+      v->info().index = index;
+    });
+    compress_(1, facetHandles_, [this](const auto& f, std::size_t index) {
+      setFacetIndex_(f, index);
+    });
+    if constexpr (dim == 3)
+      compress_(2, edgeHandles_, [this](const auto& e, std::size_t index) {
+        setEdgeIndex_(e, index);
+      });
+  }
+
+  //! Return the host element with the given index (incremental mode only)
+  const HostGridEntity<0>& elementHandle(std::size_t index) const {
+    assert(incremental_ && index < elementHandles_.size());
+    return elementHandles_[index];
+  }
+
+  //! Return the indices of the elements created or renumbered by local updates
+  const std::vector<std::size_t>& changedElements() const {
+    return changedElements_;
+  }
+
+  //! Forget about the created and renumbered elements
+  void clearChangedElements() { changedElements_.clear(); }
+
+ private:
+  //! Renumber all entities along the space-filling curve
+  void order_() {
+    using GlobalCoordinate = FieldVector<double, dim>;
+    using Curve = MMeshSpaceFillingCurve<dim>;
+    using Key = typename Curve::Key;
+
+    // the vertices of the leaf grid view
+    std::vector<std::pair<Key, HostGridEntity<dim>>> vertices;
+    vertices.reserve(sizeOfCodim_[dim]);
+    for (const auto& vertex :
+         Dune::vertices(grid_->leafGridView(), Partitions::all))
+      vertices.emplace_back(0, vertex.impl().hostEntity());
+
+    if (vertices.empty()) return;
+
+    GlobalCoordinate lower(std::numeric_limits<double>::max());
+    GlobalCoordinate upper(std::numeric_limits<double>::lowest());
+    for (const auto& v : vertices) {
+      const auto x = makeFieldVector(v.second->point());
+      for (int i = 0; i < dim; ++i) {
+        lower[i] = std::min(lower[i], x[i]);
+        upper[i] = std::max(upper[i], x[i]);
+      }
+    }
+    const Curve curve(ordering_, lower, upper);
+
+    for (auto& v : vertices)
+      v.first = curve(makeFieldVector(v.second->point()));
+
+    std::vector<std::pair<Key, HostGridEntity<0>>> cells;
+    cells.reserve(sizeOfCodim_[0]);
+    for (const auto& element :
+         Dune::elements(grid_->leafGridView(), Partitions::all)) {
+      const auto& c = element.impl().hostEntity();
+      GlobalCoordinate center(0.0);
+      for (int k = 0; k < dim + 1; ++k)
+        center += makeFieldVector(c->vertex(k)->point());
+      center /= dim + 1;
+      cells.emplace_back(curve(center), c);
+    }
+
+    const auto byKey = [](const auto& a, const auto& b) {
+      return a.first < b.first;
+    };
+    std::stable_sort(vertices.begin(), vertices.end(), byKey);
+    std::stable_sort(cells.begin(), cells.end(), byKey);
+
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+      vertices[i].second->info().index = i;
+    for (std::size_t i = 0; i < cells.size(); ++i)
+      cells[i].second->info().index = i;
+
+    // collect the facets and edges in the order of the elements, the old
+    // indices are read before any of them is overwritten
+    std::vector<bool> facetDone(sizeOfCodim_[1], false);
+    std::vector<bool> edgeDone(dim == 3 ? sizeOfCodim_[dim - 1] : 0, false);
+    std::vector<HostGridEntity<1>> facets(sizeOfCodim_[1]);
+    std::vector<HostGridEntity<dim - 1>> edges;
+    if constexpr (dim == 3) edges.resize(sizeOfCodim_[dim - 1]);
+
+    std::size_t facetCount = 0, edgeCount = 0;
+    for (const auto& entry : cells) {
+      const auto& c = entry.second;
+
+      for (int i = 0; i < dim + 1; ++i) {
+        const std::size_t old = c->info().facetIndex[i];
+        if (facetDone[old]) continue;
+        facetDone[old] = true;
+        facets[facetCount++] = HostGridEntity<1>(c, i);
+      }
+
+      if constexpr (dim == 3)
+        for (int i = 0; i < dim; ++i)
+          for (int j = i + 1; j < dim + 1; ++j) {
+            const std::size_t old =
+                c->info().edgeIndex[MMeshImpl::cgalEdgeIndex(i, j)];
+            if (edgeDone[old]) continue;
+            edgeDone[old] = true;
+            edges[edgeCount++] = HostGridEntity<dim - 1>(c, i, j);
+          }
+    }
+
+    // facets and edges that are not contained in a leaf element
+    if (facetCount != sizeOfCodim_[1] ||
+        (dim == 3 && edgeCount != sizeOfCodim_[dim - 1]))
+      DUNE_THROW(InvalidStateException,
+                 "Not all facets or edges are contained in leaf elements!");
+
+    for (std::size_t i = 0; i < facetCount; ++i) setFacetIndex_(facets[i], i);
+    if constexpr (dim == 3)
+      for (std::size_t i = 0; i < edgeCount; ++i) setEdgeIndex_(edges[i], i);
+
+    if (incremental_) {
+      for (std::size_t i = 0; i < vertices.size(); ++i)
+        vertexHandles_[i] = vertices[i].second;
+      for (std::size_t i = 0; i < cells.size(); ++i)
+        elementHandles_[i] = cells[i].second;
+      facetHandles_ = facets;
+      if constexpr (dim == 3) edgeHandles_ = edges;
+    }
+  }
+
+  //! Write the index of a facet into both adjacent cells
+  void setFacetIndex_(const HostGridEntity<1>& facet, std::size_t index) {
+    facet.first->info().facetIndex[facet.second] = index;
+    if (facet.first->neighbor(facet.second) != HostGridEntity<0>()) {
+      const HostGridEntity<0> n = facet.first->neighbor(facet.second);
+      n->info().facetIndex[n->index(facet.first)] = index;
+    }
+  }
+
+  //! Write the index of an edge into all incident cells (3d)
+  template <class HostEdge>
+  void setEdgeIndex_(const HostEdge& edge, std::size_t index) {
+    const auto v0 = edge.first->vertex(edge.second);
+    const auto v1 = edge.first->vertex(edge.third);
+
+    auto cit = grid_->getHostGrid().incident_cells(edge);
+    const auto cend = cit;
+    do {
+      const std::size_t k =
+          MMeshImpl::cgalEdgeIndex(cit->index(v0), cit->index(v1));
+      cit->info().edgeIndex[k] = index;
+    } while (++cit != cend);
   }
 
+  //! Return a free index of the given codim and store the handle
+  template <class Handles, class Handle>
+  std::size_t insertIndex_(int codim, Handles& handles, const Handle& h) {
+    auto& free = freeIndices_[codim];
+    if (!free.empty()) {
+      const std::size_t index = free.back();
+      free.pop_back();
+      handles[index] = h;
+      return index;
+    }
+
+    handles.push_back(h);
+    ++sizeOfCodim_[codim];
+    checkSize_(codim);
+    return sizeOfCodim_[codim] - 1;
+  }
+
+  //! Throw if the indices of a codim do not fit into the index type of the
+  //! element and vertex infos
+  void checkSize_(int codim) const {
+    using Index = std::remove_reference_t<
+        decltype(std::declval<HostGridEntity<0>>()->info().index)>;
+    if (sizeOfCodim_[codim] > std::size_t(std::numeric_limits<Index>::max()))
+      DUNE_THROW(GridError, "The number of entities of codim "
+                                << codim << " exceeds the index range!");
+  }
+
+  //! Move the entities with the largest indices to the free indices
+  template <class Handles, class SetIndex>
+  void compress_(int codim, Handles& handles, const SetIndex& setIndex) {
+    auto& free = freeIndices_[codim];
+    std::size_t& size = sizeOfCodim_[codim];
+    std::sort(free.begin(), free.end());
+
+    for (std::size_t lo = 0; lo < free.size();) {
+      if (free.back() == size - 1) {
+        free.pop_back();
+        --size;
+        continue;
+      }
+
+      handles[free[lo]] = handles[size - 1];
+      setIndex(handles[free[lo]], free[lo]);
+      ++lo;
+      --size;
+    }
+
+    free.clear();
+    handles.resize(size);
+  }
+
+  //! Return if a sorted vector of handles contains h
+  template <class Handle>
+  static bool contains_(const std::vector<Handle>& sorted, const Handle& h) {
+    return std::binary_search(sorted.begin(), sorted.end(), h);
+  }
+
+  void clearHandles_() {
+    elementHandles_.clear();
+    vertexHandles_.clear();
+    facetHandles_.clear();
+    edgeHandles_.clear();
+    for (auto& free : freeIndices_) free.clear();
+    changedElements_.clear();
+  }
+
+ public:
   GridImp* grid_;
   std::array<std::size_t, dim + 1> sizeOfCodim_;
-  std::array<CodimIndexMap, dim - 1> codimIndexMap_;
+
+ private:
+  MMeshOrdering ordering_ = MMeshOrdering::none;
+
+  // data for the incremental update
+  bool incremental_ = false;
+  std::vector<HostGridEntity<0>> elementHandles_;
+  std::vector<HostGridEntity<dim>> vertexHandles_;
+  std::vector<HostGridEntity<1>> facetHandles_;
+  std::vector<HostGridEntity<dim - 1>> edgeHandles_;
+  std::array<std::vector<std::size_t>, dim + 1> freeIndices_, released_;
+  std::vector<HostGridEntity<0>> vanishing_;
+  std::vector<HostGridEntity<1>> ring_;
+  std::vector<std::size_t> changedElements_;
 };
 
 template <class GridImp>
@@ -360,8 +840,8 @@ class MMeshGlobalIdSet
         return e.impl().id();
       case 1:
         if (e.impl().id() != dummyId) {
-          auto id0 = e.impl().id().vt()[i < 2 ? 0 : 1];
-          auto id1 = e.impl().id().vt()[i == 0 ? 1 : 2];
+          auto id0 = e.impl().id()[i < 2 ? 0 : 1];
+          auto id1 = e.impl().id()[i == 0 ? 1 : 2];
           return IdType({std::min(id0, id1), std::max(id0, id1)});
         } else {
           std::size_t id0 = (i < 2 ? -4 : -3);
@@ -370,7 +850,7 @@ class MMeshGlobalIdSet
         }
       case 2:
         if (e.impl().id() != dummyId)
-          return e.impl().id().vt()[i];
+          return e.impl().id()[i];
         else
           return IdType(std::size_t(-4 + i));
     };
@@ -383,6 +863,26 @@ class MMeshGlobalIdSet
           0>::Entity& e,
       int i, int codim) const {
     assert(0 <= codim && codim <= dim);
+
+    // The element id consists of the sorted vertex ids, i.e. the k-th id is
+    // the one of the k-th vertex of the reference element
+    const IdType& eid = e.impl().id();
+    if (codim > 0 && eid.size() == dim + 1) {
+      std::array<typename IdType::T, dim + 1> ids;
+      const std::size_t n = dim + 1 - codim;
+      for (std::size_t k = 0; k < n; ++k)
+        ids[k] = eid[MMeshImpl::refSubVertex<dim>(i, codim, k)];
+
+      switch (n) {
+        case 1:
+          return IdType(ids[0]);
+        case 2:
+          return IdType({ids[0], ids[1]});
+        case 3:
+          return IdType({ids[0], ids[1], ids[2]});
+      };
+    }
+
     switch (codim) {
       case 0:
         return id<0>(e.impl().template subEntity<0>(i));
@@ -413,7 +913,7 @@ class MMeshGlobalIdSet
     // Compute mapping DUNE vertex index to CGAL vertex index
     for (auto fh = hostgrid.all_faces_begin(); fh != hostgrid.all_faces_end();
          ++fh)
-      fh->info().cgalIndex = MMeshImpl::computeCGALIndices<decltype(fh), 2>(fh);
+      MMeshImpl::setCGALIndices<decltype(fh), 2>(fh);
   }
 
   //! update id set in 3d
@@ -433,7 +933,7 @@ class MMeshGlobalIdSet
     // Compute mapping DUNE vertex index to CGAL vertex index
     for (auto ch = hostgrid.all_cells_begin(); ch != hostgrid.all_cells_end();
          ++ch)
-      ch->info().cgalIndex = MMeshImpl::computeCGALIndices<decltype(ch), 3>(ch);
+      MMeshImpl::setCGALIndices<decltype(ch), 3>(ch);
   }
 
   //! advanced method to set the id of a vertex manually
@@ -0,0 +1,431 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_MMESH_GRID_INTERFACEREGISTRY_HH
+#define DUNE_MMESH_GRID_INTERFACEREGISTRY_HH
+
+/** \file
+ * \brief The MMeshInterfaceRegistry class
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+
+// MMesh includes
+#include <dune/mmesh/grid/memoryusage.hh>
+#include <dune/mmesh/grid/multiid.hh>
+
+namespace Dune {
+
+/** \brief Explicit list of the interface entities of an MMesh
+ *  \ingroup MMesh
+ *
+ *  The registry stores the interface segments by their vertex handles and
+ *  caches the corresponding host facets (and in 3d the host edges) such that
+ *  the interface can be traversed in O(#interface) instead of scanning the
+ *  whole bulk triangulation. Vertex handles stay valid when the triangulation
+ *  is modified, the cached host facets have to be refreshed by update() after
+ *  each change of the topology.
+ *
+ *  Additionally, the registry maintains the interface flags of the cells
+ *  (one bit per facet and in 3d one bit per edge) that are used for constant
+ *  time isInterface() queries. Changes of the triangulation have to be
+ *  reported by beginChange() and endChange() to keep these flags valid.
+ */
+template <class Grid>
+class MMeshInterfaceRegistry {
+ public:
+  static constexpr int dim = Grid::dimension;
+
+  using IdType = typename Grid::IdType;
+  using ElementHandle = typename Grid::ElementHandle;
+  using FacetHandle = typename Grid::FacetHandle;
+  using EdgeHandle = typename Grid::EdgeHandle;
+  using VertexHandle = typename Grid::VertexHandle;
+
+  //! An interface segment given by its vertices
+  using Segment = std::array<VertexHandle, dim>;
+
+  explicit MMeshInterfaceRegistry(const Grid& grid) : grid_(grid) {}
+
+  //! Rebuild the registry from the interface segments and vertex flags
+  void build() {
+    segments_.clear();
+    facets_.clear();
+    segmentPosition_.clear();
+    vertices_.clear();
+    vertexPosition_.clear();
+    edgeVertices_.clear();
+    edges_.clear();
+    edgeCount_.clear();
+    edgePosition_.clear();
+
+    const auto& hostgrid = grid_.getHostGrid();
+
+    if constexpr (dim == 2) {
+      for (auto fit = hostgrid.all_faces_begin();
+           fit != hostgrid.all_faces_end(); ++fit)
+        fit->info().interfaceFacets = 0;
+    } else {
+      for (auto cit = hostgrid.all_cells_begin();
+           cit != hostgrid.all_cells_end(); ++cit) {
+        cit->info().interfaceFacets = 0;
+        cit->info().interfaceEdges = 0;
+      }
+    }
+
+    std::unordered_map<std::size_t, VertexHandle> vertexMap;
+    for (auto vit = hostgrid.finite_vertices_begin();
+         vit != hostgrid.finite_vertices_end(); ++vit) {
+      VertexHandle vh = vit;
+      if (!vh->info().isInterface) continue;
+
+      insertVertex(vh);
+      vertexMap.insert({vh->info().id, vh});
+    }
+
+    for (const auto& iseg : grid_.interfaceSegments()) {
+      if (iseg.first.size() != dim) continue;
+
+      const auto& ids = iseg.first;
+      Segment segment;
+      bool found = true;
+      for (int i = 0; i < dim && found; ++i) {
+        auto it = vertexMap.find(ids[i]);
+        found = (it != vertexMap.end());
+        if (found) segment[i] = it->second;
+      }
+
+      if (found) insertSegment(segment);
+    }
+  }
+
+  //! Recompute the cached host entities after a change of the topology
+  void update() {
+    for (std::size_t i = 0; i < segments_.size(); ++i) {
+      facets_[i] = findFacet_(segments_[i]);
+      markFacet_(facets_[i], true);
+    }
+
+    if constexpr (dim == 3)
+      for (std::size_t i = 0; i < edgeVertices_.size(); ++i) {
+        edges_[i] = findEdge_(edgeVertices_[i]);
+        markEdge_(edges_[i], true);
+      }
+  }
+
+  /** \brief Begin a local change of the triangulation
+   *  \param cells   the cells that will vanish
+   *  \param removed the vertex that will be removed (if any)
+   */
+  template <class Cells>
+  void beginChange(const Cells& cells,
+                   const VertexHandle& removed = VertexHandle()) {
+    changed_.clear();
+    if (segments_.empty()) return;
+
+    for (const auto& cell : cells)
+      for (int i = 0; i <= dim; ++i) {
+        const VertexHandle v = cell->vertex(i);
+        if (v != removed && !grid_.getHostGrid().is_infinite(v))
+          changed_.push_back(v);
+      }
+  }
+
+  //! Recompute the interface flags of the cells created by a local change
+  void endChange(const VertexHandle& inserted = VertexHandle()) {
+    if (segments_.empty()) return;
+
+    if (inserted != VertexHandle()) changed_.push_back(inserted);
+
+    std::sort(changed_.begin(), changed_.end());
+    changed_.erase(std::unique(changed_.begin(), changed_.end()),
+                   changed_.end());
+
+    // all created cells are incident to one of these vertices
+    std::vector<ElementHandle> cells;
+    for (const auto& v : changed_) {
+      cells.clear();
+      incidentCells_(v, cells);
+      for (const auto& cell : cells) updateCell_(cell);
+    }
+    changed_.clear();
+  }
+
+  //! Discard a local change of the triangulation that did not happen
+  void cancelChange() { changed_.clear(); }
+
+  //! Add an interface segment
+  void insertSegment(const Segment& segment) {
+    const IdType ids = ids_(segment);
+    if (!segmentPosition_.insert({ids, segments_.size()}).second) return;
+
+    segments_.push_back(segment);
+    facets_.push_back(findFacet_(segment));
+    markFacet_(facets_.back(), true);
+
+    for (const auto& vh : segment) insertVertex(vh);
+
+    if constexpr (dim == 3)
+      for (int i = 0; i < dim; ++i)
+        insertEdge_({segment[i], segment[(i + 1) % dim]});
+  }
+
+  //! Remove the interface segment with the given (sorted) vertex ids
+  void eraseSegment(const IdType& ids) {
+    auto it = segmentPosition_.find(ids);
+    if (it == segmentPosition_.end()) return;
+
+    const std::size_t pos = it->second;
+    segmentPosition_.erase(it);
+    markFacet_(findFacet_(segments_[pos]), false);
+
+    if constexpr (dim == 3)
+      for (int i = 0; i < dim; ++i)
+        eraseEdge_({segments_[pos][i], segments_[pos][(i + 1) % dim]});
+
+    const std::size_t last = segments_.size() - 1;
+    if (pos != last) {
+      segments_[pos] = segments_[last];
+      facets_[pos] = facets_[last];
+      segmentPosition_[ids_(segments_[pos])] = pos;
+    }
+    segments_.pop_back();
+    facets_.pop_back();
+  }
+
+  //! Add an interface vertex
+  void insertVertex(const VertexHandle& vh) {
+    if (vertexPosition_.insert({vh->info().id, vertices_.size()}).second)
+      vertices_.push_back(vh);
+  }
+
+  //! Remove an interface vertex
+  void eraseVertex(const VertexHandle& vh) {
+    auto it = vertexPosition_.find(vh->info().id);
+    if (it == vertexPosition_.end()) return;
+
+    const std::size_t pos = it->second;
+    vertexPosition_.erase(it);
+
+    const std::size_t last = vertices_.size() - 1;
+    if (pos != last) {
+      vertices_[pos] = vertices_[last];
+      vertexPosition_[vertices_[pos]->info().id] = pos;
+    }
+    vertices_.pop_back();
+  }
+
+  //! Return the host facets of the interface segments
+  const std::vector<FacetHandle>& facets() const { return facets_; }
+
+  //! Return the host edges of the interface segments (3d)
+  const std::vector<EdgeHandle>& edges() const { return edges_; }
+
+  //! Return the interface vertices
+  const std::vector<VertexHandle>& vertices() const { return vertices_; }
+
+  //! Return if a host facet is part of the interface
+  static bool isInterface(const FacetHandle& facet) {
+    return (facet.first->info().interfaceFacets >> facet.second) & 1;
+  }
+
+  //! Return if a host edge is part of the interface (3d)
+  template <int d = dim>
+  static std::enable_if_t<d == 3, bool> isInterface(const EdgeHandle& edge) {
+    const std::size_t i = MMeshImpl::cgalEdgeIndex(edge.second, edge.third);
+    return (edge.first->info().interfaceEdges >> i) & 1;
+  }
+
+  //! Return if a cached host entity is part of the current triangulation
+  template <class HostEntity>
+  static bool valid(const HostEntity& entity) {
+    return entity.first != ElementHandle();
+  }
+
+  //! Return the (estimated) number of bytes used by the registry
+  std::size_t memoryUsage() const {
+    using MMeshImpl::memoryUsage;
+    return memoryUsage(segments_) + memoryUsage(facets_) +
+           memoryUsage(segmentPosition_) + memoryUsage(vertices_) +
+           memoryUsage(vertexPosition_) + memoryUsage(edgeVertices_) +
+           memoryUsage(edges_) + memoryUsage(edgeCount_) +
+           memoryUsage(edgePosition_) + memoryUsage(changed_);
+  }
+
+ private:
+  //! Return the sorted vertex ids of a simplex
+  template <std::size_t n>
+  static IdType ids_(const std::array<VertexHandle, n>& vertices) {
+    std::vector<std::size_t> ids(n);
+    for (std::size_t i = 0; i < n; ++i) ids[i] = vertices[i]->info().id;
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  //! Find the host facet of a segment, returns an invalid facet otherwise
+  FacetHandle findFacet_(const Segment& segment) const {
+    FacetHandle facet;
+    if constexpr (dim == 2) {
+      if (grid_.getHostGrid().is_edge(segment[0], segment[1], facet.first,
+                                      facet.second))
+        return facet;
+    } else {
+      int i, j, k;
+      if (grid_.getHostGrid().is_facet(segment[0], segment[1], segment[2],
+                                       facet.first, i, j, k)) {
+        facet.second = 6 - i - j - k;
+        return facet;
+      }
+    }
+    return FacetHandle();
+  }
+
+  //! Find the host edge of two vertices, returns an invalid edge otherwise
+  EdgeHandle findEdge_(const std::array<VertexHandle, 2>& vertices) const {
+    EdgeHandle edge;
+    if (grid_.getHostGrid().is_edge(vertices[0], vertices[1], edge.first,
+                                    edge.second, edge.third))
+      return edge;
+    return EdgeHandle();
+  }
+
+  //! Set or clear the interface flag of a facet on both sides
+  static void markFacet_(const FacetHandle& facet, bool flag) {
+    if (!valid(facet)) return;
+
+    const auto& cell = facet.first;
+    const auto neighbor = cell->neighbor(facet.second);
+    setBit_(cell->info().interfaceFacets, facet.second, flag);
+    setBit_(neighbor->info().interfaceFacets, neighbor->index(cell), flag);
+  }
+
+  //! Set or clear the interface flag of an edge in all incident cells (3d)
+  void markEdge_(const EdgeHandle& edge, bool flag) const {
+    if (!valid(edge)) return;
+
+    const auto v0 = edge.first->vertex(edge.second);
+    const auto v1 = edge.first->vertex(edge.third);
+
+    auto cit = grid_.getHostGrid().incident_cells(edge);
+    const auto done = cit;
+    do {
+      const std::size_t i =
+          MMeshImpl::cgalEdgeIndex(cit->index(v0), cit->index(v1));
+      setBit_(cit->info().interfaceEdges, i, flag);
+    } while (++cit != done);
+  }
+
+  //! Set or clear a bit
+  static void setBit_(std::uint8_t& bits, std::size_t i, bool flag) {
+    if (flag)
+      bits |= (1u << i);
+    else
+      bits &= ~(1u << i);
+  }
+
+  //! Recompute the interface flags of a cell
+  void updateCell_(const ElementHandle& cell) const {
+    auto& info = cell->info();
+
+    info.interfaceFacets = 0;
+    for (int i = 0; i <= dim; ++i) {
+      Segment segment;
+      bool candidate = true;
+      for (int j = 0; j < dim; ++j) {
+        segment[j] = cell->vertex((i + j + 1) % (dim + 1));
+        candidate &= segment[j]->info().isInterface;
+      }
+
+      if (candidate && segmentPosition_.count(ids_(segment)))
+        setBit_(info.interfaceFacets, i, true);
+    }
+
+    if constexpr (dim == 3) {
+      info.interfaceEdges = 0;
+      for (int i = 0; i < dim + 1; ++i)
+        for (int j = i + 1; j < dim + 1; ++j) {
+          const std::array<VertexHandle, 2> edge{
+              {cell->vertex(i), cell->vertex(j)}};
+          if (edge[0]->info().isInterface && edge[1]->info().isInterface &&
+              edgePosition_.count(ids_(edge)))
+            setBit_(info.interfaceEdges, MMeshImpl::cgalEdgeIndex(i, j), true);
+        }
+    }
+  }
+
+  //! Collect the cells incident to a vertex
+  void incidentCells_(const VertexHandle& v,
+                      std::vector<ElementHandle>& cells) const {
+    if constexpr (dim == 2) {
+      auto fc = grid_.getHostGrid().incident_faces(v);
+      const auto done = fc;
+      do {
+        cells.push_back(fc);
+      } while (++fc != done);
+    } else
+      grid_.getHostGrid().incident_cells(v, std::back_inserter(cells));
+  }
+
+  //! Add an interface edge (3d) or increase its number of segments
+  void insertEdge_(const std::array<VertexHandle, 2>& vertices) {
+    const IdType ids = ids_(vertices);
+    auto it = edgePosition_.find(ids);
+    if (it != edgePosition_.end()) {
+      edgeCount_[it->second]++;
+      return;
+    }
+
+    edgePosition_.insert({ids, edgeVertices_.size()});
+    edgeVertices_.push_back(vertices);
+    edges_.push_back(findEdge_(vertices));
+    edgeCount_.push_back(1);
+    markEdge_(edges_.back(), true);
+  }
+
+  //! Decrease the number of segments of an interface edge (3d)
+  void eraseEdge_(const std::array<VertexHandle, 2>& vertices) {
+    auto it = edgePosition_.find(ids_(vertices));
+    if (it == edgePosition_.end()) return;
+
+    const std::size_t pos = it->second;
+    if (--edgeCount_[pos] > 0) return;
+
+    edgePosition_.erase(it);
+    markEdge_(findEdge_(vertices), false);
+
+    const std::size_t last = edgeVertices_.size() - 1;
+    if (pos != last) {
+      edgeVertices_[pos] = edgeVertices_[last];
+      edges_[pos] = edges_[last];
+      edgeCount_[pos] = edgeCount_[last];
+      edgePosition_[ids_(edgeVertices_[pos])] = pos;
+    }
+    edgeVertices_.pop_back();
+    edges_.pop_back();
+    edgeCount_.pop_back();
+  }
+
+  const Grid& grid_;
+
+  std::vector<Segment> segments_;
+  std::vector<FacetHandle> facets_;
+  std::unordered_map<IdType, std::size_t> segmentPosition_;
+
+  std::vector<VertexHandle> vertices_;
+  std::unordered_map<std::size_t, std::size_t> vertexPosition_;
+
+  std::vector<std::array<VertexHandle, 2>> edgeVertices_;
+  std::vector<EdgeHandle> edges_;
+  std::vector<std::size_t> edgeCount_;
+  std::unordered_map<IdType, std::size_t> edgePosition_;
+
+  std::vector<VertexHandle> changed_;
+};
+
+}  // namespace Dune
+
+#endif
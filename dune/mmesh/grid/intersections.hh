@@ -161,7 +161,12 @@ class MMeshLeafIntersection {
   //! intersection of codimension 1 of this neighbor with element where
   //! iteration started. Here returned element is in GLOBAL coordinates of the
   //! element where iteration started.
-  Geometry geometry() const { return Geometry(hostIntersection_); }
+  Geometry geometry() const {
+    if (mMesh_->geometryCache().valid())
+      return Geometry(mMesh_->geometryCache().facetGeometry(
+          hostIntersection_.first->info().index, indexInInside()));
+    return Geometry(hostIntersection_);
+  }
 
   //! local number of codim 1 entity in self where intersection is contained in
   int indexInInside() const {
@@ -190,6 +195,8 @@ class MMeshLeafIntersection {
   template <int d = dim>
   typename std::enable_if_t<d == 2, NormalVector> integrationOuterNormal(
       const FieldVector<ctype, dim - 1>& local) const {
+    if (mMesh_->geometryCache().valid()) return cachedOuterNormal_();
+
     HostGridEntity face = hostIntersection_.first;
     const auto& edgeIdx = hostIntersection_.second;
 
@@ -202,6 +209,8 @@ class MMeshLeafIntersection {
   template <int d = dim>
   typename std::enable_if_t<d == 3, NormalVector> integrationOuterNormal(
       const FieldVector<ctype, dim - 1>& local) const {
+    if (mMesh_->geometryCache().valid()) return cachedOuterNormal_();
+
     HostGridEntity cell = hostIntersection_.first;
     const auto& facetIdx = hostIntersection_.second;
 
@@ -226,6 +235,12 @@ class MMeshLeafIntersection {
   }
 
  private:
+  //! return the integration outer normal from the geometry cache
+  NormalVector cachedOuterNormal_() const {
+    return mMesh_->geometryCache().integrationOuterNormal(
+        hostIntersection_.first->info().index, indexInInside());
+  }
+
   //! the host intersection
   const GridImp* mMesh_;
   HostLeafIntersection hostIntersection_;
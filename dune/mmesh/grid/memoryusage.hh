@@ -0,0 +1,113 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_MMESH_GRID_MEMORYUSAGE_HH
+#define DUNE_MMESH_GRID_MEMORYUSAGE_HH
+
+/** \file
+ * \brief The MMeshMemoryUsage class
+ */
+
+#include <array>
+#include <cstddef>
+#include <ostream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Dune {
+
+namespace MMeshImpl {
+
+//! Bytes allocated by a vector
+template <class T, class A>
+std::size_t memoryUsage(const std::vector<T, A>& v) {
+  return v.capacity() * sizeof(T);
+}
+
+//! Bytes allocated by an array of containers
+template <class T, std::size_t n>
+std::size_t memoryUsage(const std::array<T, n>& a) {
+  std::size_t bytes = 0;
+  for (const auto& t : a) bytes += memoryUsage(t);
+  return bytes;
+}
+
+//! Estimated bytes allocated by a node based hash container
+template <class Container>
+std::size_t hashContainerUsage(const Container& c) {
+  using Node = std::pair<void*, typename Container::value_type>;
+  return c.bucket_count() * sizeof(void*) + c.size() * sizeof(Node);
+}
+
+template <class K, class V, class H, class E, class A>
+std::size_t memoryUsage(const std::unordered_map<K, V, H, E, A>& m) {
+  return hashContainerUsage(m);
+}
+
+template <class K, class H, class E, class A>
+std::size_t memoryUsage(const std::unordered_set<K, H, E, A>& s) {
+  return hashContainerUsage(s);
+}
+
+}  // namespace MMeshImpl
+
+/** \brief Memory used by an MMesh, broken down by entity type
+ *  \ingroup MMesh
+ *
+ *  The host vertices and cells are counted with their info, the remaining
+ *  entries are the side tables of the grid. Heap memory of node based
+ *  containers is estimated.
+ */
+struct MMeshMemoryUsage {
+  //! Number of host vertices and cells (including the infinite ones)
+  std::size_t numVertices = 0;
+  std::size_t numElements = 0;
+
+  //! Size of a host vertex and a host cell
+  std::size_t bytesPerVertex = 0;
+  std::size_t bytesPerElement = 0;
+
+  //! Bytes of the host vertices and cells
+  std::size_t vertices = 0;
+  std::size_t elements = 0;
+
+  //! Bytes of the leaf index set (facet and edge indices are in the cells)
+  std::size_t indexSet = 0;
+
+  //! Bytes of the interface registry and the interface index set
+  std::size_t interface = 0;
+
+  //! Bytes of the partition side tables
+  std::size_t partition = 0;
+
+  //! Bytes of the geometry cache
+  std::size_t geometryCache = 0;
+
+  //! Bytes of the adaptation bookkeeping
+  std::size_t adaptation = 0;
+
+  //! Return the total number of bytes
+  std::size_t total() const {
+    return vertices + elements + indexSet + interface + partition +
+           geometryCache + adaptation;
+  }
+};
+
+inline std::ostream& operator<<(std::ostream& os,
+                                const MMeshMemoryUsage& usage) {
+  os << "vertices:       " << usage.vertices << " (" << usage.numVertices
+     << " x " << usage.bytesPerVertex << ")\n"
+     << "elements:       " << usage.elements << " (" << usage.numElements
+     << " x " << usage.bytesPerElement << ")\n"
+     << "index set:      " << usage.indexSet << "\n"
+     << "interface:      " << usage.interface << "\n"
+     << "partition:      " << usage.partition << "\n"
+     << "geometry cache: " << usage.geometryCache << "\n"
+     << "adaptation:     " << usage.adaptation << "\n"
+     << "total:          " << usage.total() << " bytes";
+  return os;
+}
+
+}  // namespace Dune
+
+#endif
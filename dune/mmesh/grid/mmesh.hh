@@ -7,7 +7,10 @@
  * \brief The MMesh class
  */
 
+#include <atomic>
 #include <memory>
+#include <numeric>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -25,24 +28,34 @@
 // The components of the MMesh interface
 #include "../interface/traits.hh"
 #include "../misc/boundaryidprovider.hh"
+#include "../misc/parallelfor.hh"
+#include "../misc/shiftfraction.hh"
 #include "../misc/twistutility.hh"
+#include "../misc/unionfind.hh"
 #include "../remeshing/distance.hh"
 #include "../remeshing/longestedgerefinement.hh"
+#include "../remeshing/meshmotion.hh"
+#include "../remeshing/quality.hh"
 #include "../remeshing/ratioindicator.hh"
+#include "../remeshing/smoothing.hh"
 #include "common.hh"
 #include "connectedcomponent.hh"
 #include "cutsettriangulation.hh"
 #include "entity.hh"
 #include "entityseed.hh"
 #include "geometry.hh"
+#include "geometrycache.hh"
 #include "hierarchiciterator.hh"
 #include "incidentiterator.hh"
 #include "indexsets.hh"
 #include "interfaceiterator.hh"
+#include "interfaceregistry.hh"
 #include "intersectioniterator.hh"
 #include "leafiterator.hh"
+#include "memoryusage.hh"
 #include "pointfieldvector.hh"
 #include "rangegenerators.hh"
+#include "spacefillingcurve.hh"
 // Further includes below!
 
 #if HAVE_MPI
@@ -220,6 +233,12 @@ class MMesh
   //! The type of the underlying vertex handle
   using VertexHandle = HostGridEntity<dimension>;
 
+  //! The type of the interface registry
+  using InterfaceRegistry = MMeshInterfaceRegistry<GridImp>;
+
+  //! The type of the geometry cache
+  using GeometryCache = MMeshGeometryCache<GridImp>;
+
   //! The type of the element output
   using ElementOutput = std::list<HostGridEntity<0>>;
 
@@ -289,10 +308,13 @@ class MMesh
 #ifdef HAVE_MPI
         comm_(MPIHelper::getCommunicator()),
 #endif
-        partitionHelper_(*this) {
+        partitionHelper_(*this),
+        interfaceRegistry_(*this),
+        geometryCache_(*this) {
     leafIndexSet_ = std::make_unique<MMeshLeafIndexSet<const GridImp>>(This());
     globalIdSet_ = std::make_unique<MMeshGlobalIdSet<const GridImp>>(This());
     globalIdSet_->update(This());
+    interfaceRegistry_.build();
 
     interfaceGrid_ =
         std::make_shared<InterfaceGrid>(This(), interfaceBoundarySegments);
@@ -309,8 +331,101 @@ class MMesh
   void update() {
     setIds();
     setIndices();
+    interfaceRegistry_.update();
     interfaceGrid_->setIds();
     interfaceGrid_->setIndices();
+    updateGeometryCache_();
+  }
+
+  /** \brief Enable incremental bookkeeping during adaptation
+   *
+   *  If enabled, adapt() only updates ids, indices and refinement flags of
+   *  the entities inside the conflict regions of the inserted and removed
+   *  vertices instead of recomputing them for the whole mesh. This is only
+   *  used on a single rank, in parallel the full update is performed.
+   */
+  void setIncrementalAdaptation(bool incremental = true) {
+    incrementalAdapt_ = incremental;
+    leafIndexSet_->setIncremental(incremental);
+    touched_.clear();
+    update();
+    tracking_ = incremental_();
+  }
+
+  //! Return if the incremental bookkeeping during adaptation is enabled
+  bool incrementalAdaptation() const { return incrementalAdapt_; }
+
+  /** \brief Number the elements and vertices along a space-filling curve
+   *
+   *  The leaf indices of elements and vertices are assigned along the Morton
+   *  or Hilbert curve and the facets (and edges) are numbered in the order of
+   *  the elements. This improves the locality of assembled matrices. The
+   *  numbering is restored at every full update of the indices, with
+   *  incremental adaptation enabled call update() to renumber.
+   */
+  void setOrdering(MMeshOrdering ordering) {
+    leafIndexSet_->setOrdering(ordering);
+    update();
+  }
+
+  //! Return the numbering of the leaf elements and vertices
+  MMeshOrdering ordering() const { return leafIndexSet_->ordering(); }
+
+  /** \brief Enable the cache of element geometries and facet normals
+   *
+   *  If enabled, the geometries and facet normals of all elements are stored
+   *  and returned by the element and intersection geometry() and by
+   *  integrationOuterNormal(). The cache is refilled when the grid is adapted,
+   *  moving vertices only refreshes the cells incident to them.
+   */
+  void setGeometryCaching(bool enable = true) {
+    cacheGeometry_ = enable;
+    updateGeometryCache_();
+  }
+
+  //! Return if the geometry cache is enabled
+  bool geometryCaching() const { return cacheGeometry_; }
+
+  //! Return the geometry cache
+  const GeometryCache& geometryCache() const { return geometryCache_; }
+
+  //! Return the memory used by the grid broken down by entity type
+  MMeshMemoryUsage memoryUsage() const {
+    using MMeshImpl::memoryUsage;
+    using Vertex = std::remove_reference_t<decltype(*VertexHandle())>;
+    using Element = std::remove_reference_t<decltype(*ElementHandle())>;
+
+    MMeshMemoryUsage usage;
+    usage.numVertices = hostgrid_.tds().number_of_vertices();
+    if constexpr (dimension == 2)
+      usage.numElements = hostgrid_.tds().number_of_faces();
+    else
+      usage.numElements = hostgrid_.tds().number_of_cells();
+
+    usage.bytesPerVertex = sizeof(Vertex);
+    usage.bytesPerElement = sizeof(Element);
+    usage.vertices = usage.numVertices * usage.bytesPerVertex;
+    usage.elements = usage.numElements * usage.bytesPerElement;
+
+    usage.indexSet = leafIndexSet_->memoryUsage();
+    usage.interface = interfaceRegistry_.memoryUsage() +
+                      interfaceGrid_->leafIndexSet().memoryUsage();
+    usage.partition = partitionHelper_.memoryUsage();
+    usage.geometryCache = geometryCache_.memoryUsage();
+    usage.adaptation = memoryUsage(componentState_) +
+        memoryUsage(insert_) + memoryUsage(inserted_) + memoryUsage(remove_) +
+        memoryUsage(flip_) + memoryUsage(removed_) + memoryUsage(touched_) +
+        memoryUsage(markElements_) + memoryUsage(indicatorValues_) +
+        memoryUsage(conflictElements_) + memoryUsage(movedStars_) +
+        inMovedStars_.capacity() / 8 + memoryUsage(cacheStars_) +
+        memoryUsage(newElements_) +
+        memoryUsage(cutSet_) + memoryUsage(cutSetOffsets_) +
+        memoryUsage(componentElements_) + memoryUsage(componentOffsets_);
+    for (const auto& component : connectedComponents_)
+      usage.adaptation += sizeof(component) + component.memoryUsage();
+    for (const auto& chunk : cutSetChunks_)
+      usage.adaptation += sizeof(chunk) + memoryUsage(chunk);
+    return usage;
   }
 
  private:
@@ -370,6 +485,18 @@ class MMesh
   //! returns the interface segment set
   InterfaceSegments& interfaceSegments() { return interfaceSegments_; }
 
+  //! returns the registry of interface entities
+  const InterfaceRegistry& interfaceRegistry() const {
+    return interfaceRegistry_;
+  }
+
+  //! rebuild the interface registry after the interface segments have been
+  //! modified via interfaceSegments()
+  void updateInterfaceRegistry() {
+    interfaceRegistry_.build();
+    interfaceRegistry_.update();
+  }
+
   //! Add an intersection to the interface
   void addInterface(const Intersection& intersection,
                     const std::size_t marker = 1) {
@@ -377,13 +504,16 @@ class MMesh
 
     const auto& facet = entity(intersection.impl().getHostIntersection());
     std::vector<std::size_t> ids;
+    typename InterfaceRegistry::Segment segment;
     for (std::size_t i = 0; i < facet.subEntities(dim); ++i) {
       const auto& vertex = facet.impl().template subEntity<dim>(i);
       vertex.impl().hostEntity()->info().isInterface = true;
-      ids.push_back(globalIdSet().id(vertex).vt()[0]);
+      ids.push_back(globalIdSet().id(vertex)[0]);
+      segment[i] = vertex.impl().hostEntity();
     }
     std::sort(ids.begin(), ids.end());
     interfaceSegments_.insert(std::make_pair(ids, marker));
+    interfaceRegistry_.insertSegment(segment);
 
     // Add interface element to connected component in order to mark element as
     // new
@@ -594,7 +724,8 @@ class MMesh
 
   //! Return if intersection is part of the interface
   bool isInterface(const Intersection& intersection) const {
-    return isInterface(entity(intersection.impl().getHostIntersection()));
+    return InterfaceRegistry::isInterface(
+        intersection.impl().getHostIntersection());
   }
 
   //! Return if intersection is part of the interface
@@ -605,44 +736,13 @@ class MMesh
 
   //! Return if element is part of the interface
   bool isInterface(const InterfaceElement& segment) const {
-    static std::vector<std::size_t> ids(segment.subEntities(dimension));
-    for (std::size_t i = 0; i < segment.subEntities(dimension); ++i) {
-      const auto& vertex = segment.impl().template subEntity<dimension>(i);
-      if (!vertex.impl().isInterface()) return false;
-
-      ids[i] = this->globalIdSet().id(vertex).vt()[0];
-    }
-
-    std::sort(ids.begin(), ids.end());
-
-    int count = interfaceSegments_.count(ids);
-    assert(count <= 1);
-    return (count > 0);
+    return InterfaceRegistry::isInterface(segment.impl().hostEntity());
   }
 
   //! Return if edge in 3d is part of an interface segment
   template <int d = dim>
   std::enable_if_t<d == 3, bool> isInterface(const Edge& edge) const {
-    std::vector<std::size_t> ids;
-    for (std::size_t i = 0; i < edge.subEntities(dimension); ++i) {
-      const auto& vertex = edge.impl().template subEntity<dimension>(i);
-
-      if (!isInterface(vertex)) return false;
-
-      ids.push_back(this->globalIdSet().id(vertex).vt()[0]);
-    }
-
-    std::sort(ids.begin(), ids.end());
-
-    for (const auto& iseg : interfaceSegments_) {
-      const auto& seg = iseg.first.vt();
-      if ((seg[0] == ids[0] && seg[1] == ids[1]) ||
-          (seg[1] == ids[0] && seg[2] == ids[1]) ||
-          (seg[0] == ids[0] && seg[2] == ids[1]))
-        return true;
-    }
-
-    return false;
+    return InterfaceRegistry::isInterface(edge.impl().hostEntity());
   }
 
   //! Return if entity shares a facet with the interface
@@ -727,29 +827,65 @@ class MMesh
     e.impl().mark(refCount);
     if (refCount > 0) ++refineMarked_;
     if (refCount < 0) ++coarsenMarked_;
+    if (refCount != 0) touch_(e.impl().hostEntity());
     return true;
   }
 
   /** \brief Mark elements for adaption using the default remeshing indicator
+   *
+   * The indicator is evaluated once per element in parallel and the values
+   * are stored, see indicatorValues().
    * \return if elements have been marked.
    */
   bool markElements() {
-    bool change = false;
     indicator_.update();
 
-    for (const auto& element : elements(this->leafGridView())) {
-      mark(indicator_(element), element);
-      change |= indicator_(element) != 0;
-    }
+    // gather the elements for random access
+    markElements_.clear();
+    for (const auto& element : elements(this->leafGridView()))
+      markElements_.push_back(element.impl().hostEntity());
+
+    indicatorValues_.assign(leafIndexSet_->size(0), 0);
+    const int marked = refineMarked_ + coarsenMarked_;
+    MMeshImpl::parallelFor(markElements_.size(), [this](std::size_t i) {
+      const Entity element = entity(markElements_[i]);
+      const int value = indicator_(element);
+      indicatorValues_[leafIndexSet_->index(element)] = value;
+      element.impl().mark(value);
+      if (value > 0) ++refineMarked_;
+      if (value < 0) ++coarsenMarked_;
+    });
+    bool change = (refineMarked_ + coarsenMarked_ != marked);
+
+    // the tracking of touched elements is not thread-safe
+    if (tracking_)
+      for (const auto& element : markElements_)
+        if (indicatorValues_[element->info().index] != 0) touch_(element);
 
     for (const auto& ielement : elements(interfaceGrid_->leafGridView())) {
-      interfaceGrid_->mark(indicator_(ielement), ielement);
-      change |= indicator_(ielement) != 0;
+      const int value = indicator_(ielement);
+      interfaceGrid_->mark(value, ielement);
+      change |= value != 0;
     }
 
     return change;
   }
 
+  /** \brief Return the indicator values of the last markElements() call
+   *
+   * The values are indexed by the leaf index of the elements and are valid
+   * until the grid is adapted.
+   */
+  const std::vector<std::int8_t>& indicatorValues() const {
+    return indicatorValues_;
+  }
+
+  //! Return the indicator value of an element, see indicatorValues()
+  int indicatorValue(const Entity& element) const {
+    assert(leafIndexSet_->index(element) < indicatorValues_.size());
+    return indicatorValues_[leafIndexSet_->index(element)];
+  }
+
   /** \brief Return refinement mark for entity
    *
    * \return refinement mark
@@ -761,7 +897,7 @@ class MMesh
   /** \brief returns false, if at least one entity is marked for adaption */
   bool preAdapt() {
     return (interfaceGrid_->preAdapt()) || (coarsenMarked_ > 0) ||
-           (remove_.size() > 0);
+           (remove_.size() > 0) || (flip_.size() > 0);
   }
 
   /** \brief Refine edge manually */
@@ -922,9 +1058,12 @@ class MMesh
            this->interfaceGrid().leafIndexSet().size(dimension - 1));
     bool change = false;
 
+    // only the cells incident to moved vertices can degenerate
+    gatherMovedStars_(shifts, movedStars_, inMovedStars_);
+
     // check if grid is still valid
-    for (const auto& element : elements(this->leafGridView()))
-      if (signedVolume_(element) <= 0.0)
+    for (const auto& hostElement : movedStars_)
+      if (signedVolume_(entity(hostElement)) <= 0.0)
         DUNE_THROW(GridError,
                    "A cell has a negative volume! Maybe the interface has been "
                    "moved too far?");
@@ -932,13 +1071,30 @@ class MMesh
     // temporarily move vertices
     moveInterface(shifts);
 
-    for (const auto& element : elements(this->leafGridView()))
+    const auto& iindexSet = this->interfaceGrid().leafIndexSet();
+    auto shift = [&](const VertexHandle& vh) {
+      return vh->info().isInterface
+                 ? shifts[iindexSet.index(interfaceGrid().entity(vh))]
+                 : GlobalCoordinate(0.0);
+    };
+    std::set<HostGridEntity<0>> flipped;
+
+    for (const auto& hostElement : movedStars_) {
+      const Entity element = entity(hostElement);
       if (signedVolume_(element) <= 0.0) {
-        // disable removing of vertices in 3d
+        // the cell vanishes by a flip, first try to find one
+        if (flipped.count(hostElement)) continue;
+        if (registerFlip_(hostElement, shift, flipped)) {
+          change = true;
+          continue;
+        }
+
+        // in 3d, remove the vertices of the cell by edge collapses
         if constexpr (dim == 3) {
-          DUNE_THROW(GridError,
-                     "Interface could not be moved, because the removal of "
-                     "vertices is not supported in 3D!");
+          if (!removeVerticesOfCell_(element, true, change))
+            DUNE_THROW(GridError,
+                       "Interface could not be moved, because no flip "
+                       "repairs a cell and no vertex of it can be removed!");
         } else {
           bool allInterface = true;
           for (std::size_t j = 0; j < element.subEntities(dimension); ++j) {
@@ -1074,11 +1230,13 @@ class MMesh
                   interfaceGrid().leafIndexSet().index(iThirdVertex);
               thirdVertex.impl().hostEntity()->point() =
                   makePoint(thirdVertex.geometry().center() - shifts[idx]);
+              geometryCache_.invalidate();
               shifts[idx] = GlobalCoordinate(0.0);
             }
           }
         }
       }
+    }
 
     // move vertices back
     for (GlobalCoordinate& s : shifts) s *= -1.0;
@@ -1087,6 +1245,61 @@ class MMesh
     return change;
   }
 
+  /** \brief Return the largest feasible fraction of the interface shifts
+   *
+   *  Moving the interface vertices by t * shifts keeps all cells positively
+   *  oriented for every t in [0, fraction). The signed volume of an incident
+   *  cell is a polynomial of degree dim in t whose smallest root in (0, 1] is
+   *  computed in closed form. The fraction is 1 if no cell degenerates.
+   *  \param shifts     Vector that maps interface vertex index to shift
+   *  \param fractions  Returns the fraction of every interface vertex, i.e.
+   *                    the minimum over its incident cells
+   */
+  FieldType maxInterfaceShiftFraction(
+      const std::vector<GlobalCoordinate>& shifts,
+      std::vector<FieldType>& fractions) const {
+    const auto& iindexSet = this->interfaceGrid().leafIndexSet();
+    assert(shifts.size() == iindexSet.size(dimension - 1));
+
+    // use local buffers, such that concurrent queries do not share state
+    std::vector<HostGridEntity<0>> movedStars;
+    std::vector<bool> inMovedStars;
+    gatherMovedStars_(shifts, movedStars, inMovedStars);
+
+    fractions.assign(shifts.size(), 1.0);
+    FieldType fraction = 1.0;
+
+    std::array<GlobalCoordinate, dimension + 1> x, s;
+    std::array<std::size_t, dimension + 1> idx;
+    for (const auto& hostElement : movedStars) {
+      for (int k = 0; k < dimension + 1; ++k) {
+        const auto& vh = hostElement->vertex(k);
+        x[k] = makeFieldVector(vh->point());
+        s[k] = GlobalCoordinate(0.0);
+        idx[k] = std::size_t(-1);
+        if (vh->info().isInterface) {
+          idx[k] = iindexSet.index(interfaceGrid().entity(vh));
+          s[k] = shifts[idx[k]];
+        }
+      }
+
+      const FieldType cellFraction = MMeshImpl::maxShiftFraction(x, s);
+      fraction = std::min(fraction, cellFraction);
+      for (int k = 0; k < dimension + 1; ++k)
+        if (idx[k] != std::size_t(-1))
+          fractions[idx[k]] = std::min(fractions[idx[k]], cellFraction);
+    }
+
+    return fraction;
+  }
+
+  //! Return the largest feasible fraction of the interface shifts
+  FieldType maxInterfaceShiftFraction(
+      const std::vector<GlobalCoordinate>& shifts) const {
+    std::vector<FieldType> fractions;
+    return maxInterfaceShiftFraction(shifts, fractions);
+  }
+
   /** \brief Mark elements such that after movement of vertices no cell
    * degenerates \param shifts Vector that maps vertex index to GlobalCoordinate
    * \return If elements have been marked.
@@ -1098,13 +1311,28 @@ class MMesh
     // temporarily move vertices
     moveVertices(shifts);
 
+    const auto& indexSet = this->leafIndexSet();
+    auto shift = [&](const VertexHandle& vh) {
+      return shifts[indexSet.index(entity(vh))];
+    };
+    std::set<HostGridEntity<0>> flipped;
+
     for (const auto& element : elements(this->leafGridView()))
       if (signedVolume_(element) <= 0.0) {
-        // disable removing of vertices in 3d
+        // the cell vanishes by a flip, first try to find one
+        const auto& hostElement = element.impl().hostEntity();
+        if (flipped.count(hostElement)) continue;
+        if (registerFlip_(hostElement, shift, flipped)) {
+          change = true;
+          continue;
+        }
+
+        // in 3d, remove the vertices of the cell by edge collapses
         if constexpr (dim == 3) {
-          DUNE_THROW(GridError,
-                     "Vertices could not be moved, because the removal of "
-                     "vertices is not supported in 3D!");
+          if (!removeVerticesOfCell_(element, false, change))
+            DUNE_THROW(GridError,
+                       "Vertices could not be moved, because no flip repairs "
+                       "a cell and no vertex of it can be removed!");
         } else {
           for (std::size_t j = 0; j < element.subEntities(dimension); ++j) {
             const auto& v = element.template subEntity<dimension>(j);
@@ -1133,38 +1361,379 @@ class MMesh
     return change;
   }
 
-  //! Callback for the grid adaptation process with restrict/prolong
+  /** \brief Callback for the grid adaptation process with restrict/prolong
+   *
+   *  The data is projected conservatively onto the new elements by the
+   *  triangulations of their cut sets with the old elements. In 3d, the cut
+   *  sets are decomposed into tetrahedra by half-space clipping. The cut sets
+   *  are computed in parallel, then prolongLocal() and restrictLocal() are
+   *  called for every simplex. These calls are only run in parallel over
+   *  the connected components if enabled by setParallelProjection().
+   */
   template <class GridImp, class DataHandle>
   bool adapt(AdaptDataHandleInterface<GridImp, DataHandle>& handle) {
+    using EntityImpl = typename Entity::Implementation;
+
     preAdapt();
     adapt();
     sequence_ += 1;
 
-    for (const auto& element : elements(this->leafGridView()))
-      if (element.isNew()) {
-        bool initialize = true;
+    computeCutSets_();
 
-        for (const auto& old : element.impl().connectedComponent().children()) {
-          const Entity& father = old;
+    auto project = [this, &handle](std::size_t i) {
+      const Entity element = entity(newElements_[i]);
+      bool initialize = true;
 
-          MMeshImpl::CutSetTriangulation<Entity> cutSetTriangulation(old,
-                                                                     element);
-          for (auto& middle : cutSetTriangulation.triangles()) {
-            middle.impl().bindFather(father);
-            handle.prolongLocal(father, middle, true);
-            middle.impl().bindFather(element);
-            handle.restrictLocal(element, middle, initialize);
+      for (std::size_t k = cutSetOffsets_[i]; k < cutSetOffsets_[i + 1]; ++k) {
+        const Entity father = *cutSet_[k].father;
+        Entity middle = EntityImpl(This(), cutSet_[k].corners);
 
-            initialize = false;
-          }
-        }
+        middle.impl().bindFather(father);
+        handle.prolongLocal(father, middle, true);
+        middle.impl().bindFather(element);
+        handle.restrictLocal(element, middle, initialize);
+
+        initialize = false;
       }
+    };
+
+    if (parallelProjection_) {
+      // the new elements of a connected component are projected by one task
+      const std::size_t numComponents = componentOffsets_.size() - 1;
+      MMeshImpl::parallelFor(numComponents, [&](std::size_t c) {
+        for (std::size_t j = componentOffsets_[c]; j < componentOffsets_[c + 1];
+             ++j)
+          project(componentElements_[j]);
+      });
+    } else
+      for (std::size_t i = 0; i < newElements_.size(); ++i) project(i);
 
     postAdapt();
     return true;
   }
 
+  /** \brief Enable the parallel restrict/prolong in adapt(handle)
+   *
+   *  The connected components are projected concurrently. This requires that
+   *  prolongLocal() and restrictLocal() of the data handle can be called
+   *  concurrently for distinct new elements. Note that all temporary
+   *  entities of the cut sets share the same id.
+   */
+  void setParallelProjection(bool enable = true) {
+    parallelProjection_ = enable;
+  }
+
+  //! Return if the restrict/prolong in adapt(handle) runs in parallel
+  bool parallelProjection() const { return parallelProjection_; }
+
  private:
+  /** \brief A flip given by the vertices of the facet (2d and 2-3 flip) or
+   *         of the edge (3-2 and 4-4 flip) that is removed
+   *
+   *  The third vertex of an edge is the default handle. The 4-4 flip creates
+   *  the edge between the ring vertex diagonal and the opposite ring vertex.
+   */
+  struct Flip {
+    std::array<VertexHandle, dimension> vertices;
+    VertexHandle diagonal;
+  };
+
+  using FlipCells = std::vector<std::array<VertexHandle, dimension + 1>>;
+
+  /** \brief Register a flip that removes an inverted cell
+   *
+   *  The flips of the facets and, in 3d, of the edges of the cell are tested.
+   *  A flip is feasible if it keeps the interface and the boundary and all
+   *  new cells are positively oriented with and without the shifts. The
+   *  cells that vanish by a registered flip are added to flipped.
+   *  \param shift Returns the shift of a vertex handle, the vertices are at
+   *               the shifted positions
+   */
+  template <class Shift>
+  bool registerFlip_(const HostGridEntity<0>& cell, const Shift& shift,
+                     std::set<HostGridEntity<0>>& flipped) {
+    std::vector<Flip> candidates;
+    for (int i = 0; i < dimension + 1; ++i) {
+      Flip flip;
+      for (int k = 0; k < dimension; ++k)
+        flip.vertices[k] = cell->vertex((i + k + 1) % (dimension + 1));
+      candidates.push_back(flip);
+    }
+
+    if constexpr (dimension == 3)
+      for (int i = 0; i < dimension; ++i)
+        for (int j = i + 1; j < dimension + 1; ++j) {
+          Flip flip;
+          flip.vertices = {{cell->vertex(i), cell->vertex(j), VertexHandle()}};
+          candidates.push_back(flip);
+
+          for (int k = 0; k < dimension + 1; ++k)
+            if (k != i && k != j) {
+              flip.diagonal = cell->vertex(k);
+              candidates.push_back(flip);
+            }
+        }
+
+    HostGridEntity<0> flipCell;
+    std::array<int, 2> local;
+    ElementOutput vanishing;
+    FlipCells newCells;
+    for (const Flip& flip : candidates) {
+      if (!flipCells_(flip, flipCell, local, vanishing, newCells)) continue;
+
+      bool free = true;
+      for (const auto& c : vanishing) free &= !flipped.count(c);
+      if (!free || !positive_(newCells, shift)) continue;
+
+      flipped.insert(vanishing.begin(), vanishing.end());
+      flip_.push_back(flip);
+      if (verbose_)
+        std::cout << "Flip because of negative volume: "
+                  << makeFieldVector(flip.vertices[0]->point()) << std::endl;
+      return true;
+    }
+    return false;
+  }
+
+  /** \brief Register the removal of the vertices of an inverted cell in 3d
+   *
+   *  Vertices at the boundary are kept. Interface vertices are only removed
+   *  if includeInterface is set and the cell has no removable bulk vertex.
+   *  \return If the cell has a removable vertex
+   */
+  template <class Element>
+  bool removeVerticesOfCell_(const Element& element, bool includeInterface,
+                             bool& change) {
+    for (const bool interface : {false, true}) {
+      if (interface && !includeInterface) break;
+
+      bool removable = false;
+      for (std::size_t j = 0; j < element.subEntities(dimension); ++j) {
+        const auto& v = element.template subEntity<dimension>(j);
+        if (v.impl().isInterface() != interface) continue;
+        if (RefinementStrategy::atBoundary(v)) continue;
+        if (interface && !RefinementStrategy::isRemoveable(
+                             interfaceGrid().entity(v.impl().hostEntity())))
+          continue;
+
+        removable = true;
+        if (removed_.insert(globalIdSet().id(v)).second) {
+          remove_.push_back(v.impl().hostEntity());
+          change = true;
+          if (verbose_)
+            std::cout << "Remove " << (interface ? "interface " : "")
+                      << "vertex because of negative volume: "
+                      << v.geometry().center() << std::endl;
+        }
+      }
+      if (removable) return true;
+    }
+    return false;
+  }
+
+  /** \brief Return the cells that vanish by a flip and the new cells
+   *
+   *  Returns false if the facet or edge does not exist, is part of the
+   *  interface or the boundary, or the flip does not fit the number of
+   *  cells around the edge. The flipped host entity is returned by the cell
+   *  and the local indices of the vertex opposite to the facet or of the
+   *  edge.
+   */
+  bool flipCells_(const Flip& flip, HostGridEntity<0>& cell,
+                  std::array<int, 2>& local, ElementOutput& vanishing,
+                  FlipCells& newCells) const {
+    vanishing.clear();
+    newCells.clear();
+
+    // the cell with vertex k replaced by v
+    auto replaced = [](const HostGridEntity<0>& c, int k,
+                       const VertexHandle& v) {
+      std::array<VertexHandle, dimension + 1> vertices;
+      for (int l = 0; l < dimension + 1; ++l) vertices[l] = c->vertex(l);
+      vertices[k] = v;
+      return vertices;
+    };
+
+    // flip of a facet
+    if (flip.vertices[dimension - 1] != VertexHandle()) {
+      int i;
+      if constexpr (dimension == 2) {
+        if (!hostgrid_.is_edge(flip.vertices[0], flip.vertices[1], cell, i))
+          return false;
+      } else {
+        int i0, i1, i2;
+        if (!hostgrid_.is_facet(flip.vertices[0], flip.vertices[1],
+                                flip.vertices[2], cell, i0, i1, i2))
+          return false;
+        i = 6 - i0 - i1 - i2;
+      }
+
+      const HostGridEntity<0> neighbor = cell->neighbor(i);
+      if (hostgrid_.is_infinite(cell) || hostgrid_.is_infinite(neighbor))
+        return false;
+      if (InterfaceRegistry::isInterface(FacetHandle(cell, i))) return false;
+
+      const VertexHandle opposite = neighbor->vertex(neighbor->index(cell));
+      for (int k = 0; k < dimension + 1; ++k)
+        if (k != i) newCells.push_back(replaced(cell, k, opposite));
+
+      vanishing.push_back(cell);
+      vanishing.push_back(neighbor);
+      local = {{i, -1}};
+      return true;
+    }
+
+    // flip of an edge in 3d
+    if constexpr (dimension == 3) {
+      const VertexHandle a = flip.vertices[0], b = flip.vertices[1];
+      int i, j;
+      if (!hostgrid_.is_edge(a, b, cell, i, j)) return false;
+      if (InterfaceRegistry::isInterface(EdgeHandle(cell, i, j))) return false;
+
+      std::vector<VertexHandle> ring;
+      auto cit = hostgrid_.incident_cells(cell, i, j);
+      const auto cend = cit;
+      do {
+        const HostGridEntity<0> c = cit;
+        if (hostgrid_.is_infinite(c)) return false;
+        vanishing.push_back(c);
+        for (int k = 0; k < dimension + 1; ++k)
+          if (c->vertex(k) != a && c->vertex(k) != b &&
+              std::find(ring.begin(), ring.end(), c->vertex(k)) == ring.end())
+            ring.push_back(c->vertex(k));
+      } while (++cit != cend);
+
+      // the new cells replace a and b by the ring vertex that is not
+      // contained in the cells around the new diagonal
+      std::vector<HostGridEntity<0>> around;
+      VertexHandle target;
+      if (vanishing.size() == 3 && flip.diagonal == VertexHandle())
+        around.push_back(cell);
+      else if (vanishing.size() == 4 && flip.diagonal != VertexHandle()) {
+        for (const auto& c : vanishing)
+          if (c->has_vertex(flip.diagonal)) around.push_back(c);
+        if (around.size() != 2) return false;
+      } else
+        return false;
+
+      for (const auto& v : ring) {
+        bool contained = false;
+        for (const auto& c : around) contained |= c->has_vertex(v);
+        if (!contained) target = v;
+      }
+
+      for (const auto& c : around) {
+        newCells.push_back(replaced(c, c->index(a), target));
+        newCells.push_back(replaced(c, c->index(b), target));
+      }
+
+      local = {{i, j}};
+      return true;
+    }
+
+    return false;
+  }
+
+  /** \brief Return if all cells are positively oriented at the current
+   *         positions of their vertices and at these positions minus the
+   *         shifts
+   */
+  template <class Shift>
+  bool positive_(const FlipCells& cells, const Shift& shift) const {
+    for (const auto& cell : cells)
+      for (int shifted = 0; shifted < 2; ++shifted) {
+        std::array<GlobalCoordinate, dimension + 1> x;
+        for (int k = 0; k < dimension + 1; ++k) {
+          x[k] = makeFieldVector(cell[k]->point());
+          if (shifted) x[k] -= shift(cell[k]);
+        }
+
+        FieldMatrix<FieldType, dimension, dimension> jacobian;
+        for (int k = 0; k < dimension; ++k) jacobian[k] = x[k + 1] - x[0];
+        if (jacobian.determinant() <= 0.0) return false;
+      }
+    return true;
+  }
+
+  //! Perform a flip on the host grid if it is still feasible
+  void flipHost_(const Flip& flip, const FlipCells& conflict,
+                 ElementOutput& elements) {
+    HostGridEntity<0> cell;
+    std::array<int, 2> local;
+    ElementOutput vanishing;
+    FlipCells newCells;
+    auto noShift = [](const VertexHandle&) { return GlobalCoordinate(0.0); };
+    if (!flipCells_(flip, cell, local, vanishing, newCells) ||
+        !positive_(newCells, noShift)) {
+      unmarkElementsForFlip_(conflict);
+      return;
+    }
+
+    const auto domainMarker = cell->info().domainMarker;
+    beginHostChange_(vanishing);
+
+    if constexpr (dimension == 2)
+      hostgrid_.flipAndGiveNewElements(cell, local[0], elements);
+    else if (local[1] < 0)
+      hostgrid_.flipAndGiveNewElements(cell, local[0], elements);
+    else if (flip.diagonal == VertexHandle())
+      hostgrid_.flipAndGiveNewElements(cell, local[0], local[1], elements);
+    else
+      hostgrid_.flipAndGiveNewElements(cell, local[0], local[1],
+                                       flip.diagonal, elements);
+
+    // an empty output means that the flip has not been performed
+    if (elements.empty()) {
+      cancelHostChange_();
+      unmarkElementsForFlip_(conflict);
+      return;
+    }
+
+    for (const auto& element : elements) {
+      element->info().domainMarker = domainMarker;
+      element->info().mightVanish = false;
+    }
+    endHostChange_();
+  }
+
+  //! Flag the cells that vanish by a flip as mightVanish, their vertices are
+  //! stored in conflict
+  void markElementsForFlip_(const Flip& flip, std::size_t label,
+                            FlipCells& conflict) {
+    HostGridEntity<0> cell;
+    std::array<int, 2> local;
+    ElementOutput vanishing;
+    FlipCells newCells;
+    if (!flipCells_(flip, cell, local, vanishing, newCells)) return;
+
+    markConflict_(vanishing, label);
+    for (const auto& element : vanishing) {
+      conflict.emplace_back();
+      for (int i = 0; i < dimension + 1; ++i)
+        conflict.back()[i] = element->vertex(i);
+    }
+  }
+
+  //! Reset the flags of the cells of a flip that has been skipped because
+  //! a previous change in the same adaptation destroyed its facet or edge
+  void unmarkElementsForFlip_(const FlipCells& conflict) {
+    for (const auto& vertices : conflict) {
+      bool valid = true;
+      for (const auto& v : vertices)
+        valid &= hostgrid_.tds().vertices().owns(v);
+      if (!valid) continue;
+
+      HostGridEntity<0> cell;
+      bool found;
+      if constexpr (dimension == 2)
+        found = hostgrid_.is_face(vertices[0], vertices[1], vertices[2], cell);
+      else
+        found = hostgrid_.is_cell(vertices[0], vertices[1], vertices[2],
+                                  vertices[3], cell);
+      if (found) cell->info().mightVanish = false;
+    }
+  }
+
   template <int d = dim>
   std::enable_if_t<d == 2, FieldType> signedVolume_(
       const Entity& element) const {
@@ -1178,45 +1747,77 @@ class MMesh
   }
 
   bool adapt_(bool buildComponents = true) {
-    if (insert_.size() == 0 && remove_.size() == 0) return false;
+    if (insert_.size() == 0 && remove_.size() == 0 && flip_.size() == 0)
+      return false;
+
+    geometryCache_.invalidate();
+    indicator_.indicesChanged();
 
     std::vector<std::size_t> insertComponentIds;
     std::vector<std::size_t> removeComponentIds;
+    std::vector<std::size_t> flipComponentIds;
+    std::vector<FlipCells> flipConflicts(flip_.size());
     static constexpr bool writeComponents = verbose_;  // for debugging
 
     if (buildComponents) {
-      // build the connected components
-      componentCount_ =
-          connectedComponents_.size() + 1;  // 0 is the default component
-
-      // we have to mark the cells repeatedly for the case that conflict zones
-      // overlap
-      bool markAgain = true;
-      std::size_t componentNumber;
-      while (markAgain) {
-        markAgain = false;
-        insertComponentIds.clear();
-        removeComponentIds.clear();
-        insertComponentIds.reserve(insert_.size());
-        removeComponentIds.reserve(remove_.size());
-
-        // mark elements as mightVanish
-        for (const auto& ip : insert_) {
-          if (ip.edgeId != IdType())
-            markAgain |= markElementsForInsertion_(ip.edge, componentNumber);
-          else
-            markAgain |= markElementForInsertion_(ip.point, componentNumber);
-
-          insertComponentIds.push_back(componentNumber - 1);
-        }
+      // every point obtains a new component that is united with the
+      // components of its conflict elements, i.e. overlapping conflict zones
+      // are merged in a single pass. The components of previous calls keep
+      // their numbers, 0 is the default component.
+      const std::size_t base = componentCount_;
+      componentSets_.reset(base);
+      conflictElements_.clear();
+      componentState_.assign(leafIndexSet_->size(0), 0);
+
+      insertComponentIds.reserve(insert_.size());
+      for (const auto& ip : insert_) {
+        const std::size_t label = componentSets_.add();
+        if (ip.edgeId != IdType())
+          markElementsForInsertion_(ip.edge, label);
+        else
+          markElementForInsertion_(ip.point, label);
+        insertComponentIds.push_back(label);
+      }
 
-        // mark elements as mightVanish
-        for (const auto& vh : remove_) {
-          markAgain |= markElementsForRemoval_(vh, componentNumber);
-          removeComponentIds.push_back(componentNumber - 1);
-        }
+      removeComponentIds.reserve(remove_.size());
+      for (const auto& vh : remove_) {
+        const std::size_t label = componentSets_.add();
+        markElementsForRemoval_(vh, label);
+        removeComponentIds.push_back(label);
       }
 
+      flipComponentIds.reserve(flip_.size());
+      for (std::size_t fi = 0; fi < flip_.size(); ++fi) {
+        const std::size_t label = componentSets_.add();
+        markElementsForFlip_(flip_[fi], label, flipConflicts[fi]);
+        flipComponentIds.push_back(label);
+      }
+
+      // number the new components consecutively, existing components keep
+      // their number as they are the representatives of their sets
+      std::vector<std::size_t> number(componentSets_.size());
+      for (std::size_t label = 0; label < number.size(); ++label) {
+        const std::size_t root = componentSets_.find(label);
+        if (root < base)
+          number[label] = root;
+        else if (root == label)
+          number[label] = componentCount_++;
+        else
+          number[label] = number[root];
+      }
+
+      // elements in several conflict zones occur repeatedly, hence, we read
+      // all labels before writing the numbers
+      std::vector<std::size_t> labels;
+      labels.reserve(conflictElements_.size());
+      for (const auto& element : conflictElements_)
+        labels.push_back(element->info().componentNumber);
+      for (std::size_t i = 0; i < conflictElements_.size(); ++i)
+        conflictElements_[i]->info().componentNumber = number[labels[i]];
+      for (auto& id : insertComponentIds) id = number[id] - 1;
+      for (auto& id : removeComponentIds) id = number[id] - 1;
+      for (auto& id : flipComponentIds) id = number[id] - 1;
+
       buildConnectedComponents_();
 
       // plot connected components
@@ -1225,6 +1826,7 @@ class MMesh
 
     // actually insert the points
     std::vector<VertexHandle> newVertices;
+    ElementOutput vanishing;
     for (const auto& ip : insert_) {
       VertexHandle vh;
       bool connect = false;
@@ -1247,28 +1849,46 @@ class MMesh
                 ip.edge.impl().template subEntity<dim>(1).impl().hostEntity())
           connect = true;
 
+        vanishing.clear();
+        getIncidentToEdge_(ip.edge, vanishing);
+        beginHostChange_(vanishing);
+
         if (ip.isInterface == true)
           vh = insertInInterface_(ip);
         else
           vh = insertInEdge_(ip.point, eh);
 
+        endHostChange_(vh);
         vh->info().insertionLevel = ip.insertionLevel;
       } else {
-        vh = insertInCell_(ip.point);
+        auto cell = hostgrid_.locate(ip.point);
+        beginHostChange_(ElementOutput{cell});
+        vh = insertInCell_(ip.point, cell);
+        endHostChange_(vh);
 
         // check if edge is really part of the triangulation
         if (ip.v0 != VertexHandle() &&
             !getHostGrid().tds().is_edge(ip.v0, vh))  // TODO 3D
         {
           // try again with half distance
-          if constexpr (dimension == 2) hostgrid_.remove(vh);
+          if constexpr (dimension == 2) {
+            vanishing.clear();
+            getIncidentToVertex_(vh, vanishing);
+            beginHostChange_(vanishing, vh);
+            hostgrid_.remove(vh);
+            endHostChange_();
+          }
 
           GlobalCoordinate x;
           x = makeFieldVector(ip.point);
           x -= makeFieldVector(ip.v0->point());
           x *= 0.5;
           x += makeFieldVector(ip.v0->point());
-          vh = insertInCell_(makePoint(x));
+
+          cell = hostgrid_.locate(makePoint(x));
+          beginHostChange_(ElementOutput{cell});
+          vh = insertInCell_(makePoint(x), cell);
+          endHostChange_(vh);
 
           if (!getHostGrid().tds().is_edge(ip.v0, vh))  // TODO 3D
           {
@@ -1282,7 +1902,7 @@ class MMesh
           }
         }
 
-        globalIdSet_->setNextId(vh);
+        if (!vh->info().idWasSet) globalIdSet_->setNextId(vh);
         vh->info().insertionLevel = ip.insertionLevel;
 
         if (ip.isInterface) connect = true;
@@ -1290,23 +1910,26 @@ class MMesh
 
       // connect vertex and ip.v0 with interface
       if (connect) {
+        if (!vh->info().idWasSet) globalIdSet_->setNextId(vh);
         std::size_t id = vh->info().id;
         vh->info().isInterface = true;
         std::vector<std::size_t> ids;
         ids.push_back(id);
-        ids.push_back(globalIdSet().id(entity(ip.v0)).vt()[0]);
+        ids.push_back(globalIdSet().id(entity(ip.v0))[0]);
         std::sort(ids.begin(), ids.end());
         interfaceSegments_.insert(std::make_pair(
             ids, 1));  // TODO: compute interface marker corresponding to ip.v0
 
+        interfaceRegistry_.insertVertex(vh);
+        if constexpr (dim == 2) interfaceRegistry_.insertSegment({vh, ip.v0});
+
         // pass this refinement information to the interface grid
         interfaceGrid_->markAsRefined(/*children*/ {ids},
                                       ip.connectedcomponent);
 
         // set boundary segment to the same as ip.v0 if possible, default to 0
-        auto v0id = interfaceGrid_->globalIdSet()
-                        .id(interfaceGrid_->entity(ip.v0))
-                        .vt()[0];
+        auto v0id =
+            interfaceGrid_->globalIdSet().id(interfaceGrid_->entity(ip.v0))[0];
         auto it = interfaceGrid_->boundarySegments().find({v0id});
         if (it != interfaceGrid_->boundarySegments().end())
           interfaceGrid_->addBoundarySegment({id}, it->second);
@@ -1321,12 +1944,35 @@ class MMesh
     // actually remove the points
     int ci = 0;
     for (const auto& vh : remove_) {
+      vanishing.clear();
+      getIncidentToVertex_(vh, vanishing);
+      beginHostChange_(vanishing, vh);
+
       ElementOutput elements;
-      if (vh->info().isInterface)
+      if (vh->info().isInterface) {
+        const GlobalCoordinate removed = makeFieldVector(vh->point());
         elements = removeFromInterface_(vh);
-      else
+
+        // the interface changed in the new elements, it moved by at most
+        // twice the distance of their vertices to the removed vertex
+        for (const auto& element : elements)
+          for (int i = 0; i < dimension + 1; ++i) {
+            const auto& v = element->vertex(i);
+            if (hostgrid_.is_infinite(v)) continue;
+
+            GlobalCoordinate d = makeFieldVector(v->point());
+            d -= removed;
+            indicator_.vertexChanged(entity(v), 2.0 * d.two_norm());
+          }
+      } else
         hostgrid_.removeAndGiveNewElements(vh, elements);
 
+      // an empty output means that the vertex has not been removed
+      if (elements.empty())
+        cancelHostChange_();
+      else
+        endHostChange_();
+
       // flag all elements inside conflict area as new and map connected
       // component
       if (buildComponents)
@@ -1334,15 +1980,33 @@ class MMesh
       ci++;
     }
 
-    // first update ids
-    setIds();
-    interfaceGrid_->setIds();
+    // actually flip the facets and edges
+    for (std::size_t fi = 0; fi < flip_.size(); ++fi) {
+      ElementOutput elements;
+      flipHost_(flip_[fi], flipConflicts[fi], elements);
 
-    // then, update partitions
-    if (comm().size() > 1) partitionHelper_.updatePartitions();
+      if (buildComponents)
+        markElementsAfterRemoval_(elements, flipComponentIds[fi]);
+    }
 
-    // afterwards, update index sets
-    setIndices();
+    // the host facets of the interface might have changed
+    interfaceRegistry_.update();
+
+    if (tracking_) {
+      // ids and indices have been updated locally, only close the gaps
+      leafIndexSet_->compress();
+      interfaceGrid_->setIds();
+    } else {
+      // first update ids
+      setIds();
+      interfaceGrid_->setIds();
+
+      // then, update partitions
+      if (comm().size() > 1) partitionHelper_.updatePartitions();
+
+      // afterwards, update index sets
+      setIndices();
+    }
 
     if (buildComponents) {
       // flag incident elements as new and map connected component
@@ -1358,10 +2022,42 @@ class MMesh
       if (writeComponents) writeComponents_();
     }
 
-    loadBalance();
+    // on a single rank the distribution only resets the leaf iterators
+    if (tracking_) {
+      partitionHelper_.distribute();
+      updateGeometryCache_();
+    } else
+      loadBalance();
+
     return newVertices.size() > 0;
   }
 
+  //! Prepare the incremental update for a local change of the host grid
+  template <class Cells>
+  void beginHostChange_(const Cells& vanishing,
+                        const VertexHandle& vh = VertexHandle()) {
+    if (tracking_) leafIndexSet_->beginUpdate(vanishing, vh);
+    interfaceRegistry_.beginChange(vanishing, vh);
+  }
+
+  //! Update ids and indices after a local change of the host grid
+  void endHostChange_(const VertexHandle& vh = VertexHandle()) {
+    interfaceRegistry_.endChange(vh);
+    if (!tracking_) return;
+
+    if (vh != VertexHandle() && !vh->info().idWasSet)
+      globalIdSet_->setNextId(vh);
+
+    // fall back to the full update if the change could not be tracked
+    tracking_ = leafIndexSet_->endUpdate(vh);
+  }
+
+  //! Discard a local change of the host grid that did not happen
+  void cancelHostChange_() {
+    if (tracking_) leafIndexSet_->cancelUpdate();
+    interfaceRegistry_.cancelChange();
+  }
+
   template <int d = dim>
   std::enable_if_t<d == 2, void> getEdge_(const RefinementInsertionPoint& ip,
                                           EdgeHandle& eh) const {
@@ -1389,14 +2085,14 @@ class MMesh
   }
 
   template <int d = dim>
-  std::enable_if_t<d == 2, VertexHandle> insertInCell_(const Point& point) {
-    auto face = hostgrid_.locate(point);
+  std::enable_if_t<d == 2, VertexHandle> insertInCell_(
+      const Point& point, const HostGridEntity<0>& face) {
     return hostgrid_.insert_in_face(point, face);
   }
 
   template <int d = dim>
-  std::enable_if_t<d == 3, VertexHandle> insertInCell_(const Point& point) {
-    auto cell = hostgrid_.locate(point);
+  std::enable_if_t<d == 3, VertexHandle> insertInCell_(
+      const Point& point, const HostGridEntity<0>& cell) {
     return hostgrid_.insert_in_cell(point, cell);
   }
 
@@ -1408,11 +2104,18 @@ class MMesh
     const auto& iindexSet = this->interfaceGrid().leafIndexSet();
     assert(shifts.size() == iindexSet.size(dimension - 1));
 
+    std::vector<VertexHandle> moved;
     for (const auto& vertex : vertices(this->interfaceGrid().leafGridView())) {
       const VertexHandle& vh = vertex.impl().hostEntity();
-      vh->point() = makePoint(vertex.geometry().center() +
-                              shifts[iindexSet.index(vertex)]);
+      const auto& shift = shifts[iindexSet.index(vertex)];
+      vh->point() = makePoint(vertex.geometry().center() + shift);
+      if (shift != GlobalCoordinate(0.0)) {
+        indicator_.vertexChanged(entity(vh), shift.two_norm());
+        moved.push_back(vh);
+      }
     }
+
+    updateGeometryCache_(moved);
   }
 
   /** \brief Move vertices
@@ -1422,11 +2125,19 @@ class MMesh
     const auto& indexSet = this->leafIndexSet();
     assert(shifts.size() == indexSet.size(dimension));
 
+    std::vector<VertexHandle> moved;
     for (const auto& vertex : vertices(this->leafGridView())) {
       const VertexHandle& vh = vertex.impl().hostEntity();
-      vh->point() = makePoint(vertex.geometry().center() +
-                              shifts[indexSet.index(vertex)]);
+      const auto& shift = shifts[indexSet.index(vertex)];
+      vh->point() = makePoint(vertex.geometry().center() + shift);
+      if (shift != GlobalCoordinate(0.0)) {
+        indicator_.vertexChanged(
+            vertex, vertex.impl().isInterface() ? shift.two_norm() : 0.0);
+        moved.push_back(vh);
+      }
     }
+
+    updateGeometryCache_(moved);
   }
 
   //! Insert p into the triangulation and add a new interface segment between p
@@ -1454,21 +2165,42 @@ class MMesh
 
   //! Clean up refinement markers
   void postAdapt() {
-    for (const Entity& entity : elements(this->leafGridView())) {
+    auto reset = [this](const Entity& entity) {
       mark(0, entity);
       entity.impl().setIsNew(false);
       entity.impl().setWillVanish(false);
       entity.impl().hostEntity()->info().componentNumber = 0;
-    }
+    };
+
+    if (tracking_) {
+      // only the touched and the created elements carry markers, the
+      // touched elements are stored by handle as the indices might have
+      // changed and skipped if they vanished
+      for (const auto& element : touched_)
+        if (ownsElement_(element)) reset(entity(element));
+
+      const std::size_t size = leafIndexSet_->size(0);
+      for (std::size_t index : leafIndexSet_->changedElements())
+        if (index < size) reset(entity(leafIndexSet_->elementHandle(index)));
+    } else
+      for (const Entity& entity : elements(this->leafGridView()))
+        reset(entity);
+
+    touched_.clear();
+    if (leafIndexSet_->incremental()) leafIndexSet_->clearChangedElements();
+    tracking_ = incremental_();
 
     refineMarked_ = 0;
     coarsenMarked_ = 0;
-    createdEntityConnectedComponentMap_.clear();
-    vanishingEntityConnectedComponentMap_.clear();
-    connectedComponents_.clear();
+
+    // keep the storage of the components for the next adaptation
+    for (std::size_t i = 0; i + 1 < componentCount_; ++i)
+      connectedComponents_[i].clear();
+    componentCount_ = 1;
 
     insert_.clear();
     remove_.clear();
+    flip_.clear();
     inserted_.clear();
     removed_.clear();
   }
@@ -1503,36 +2235,123 @@ class MMesh
                      std::to_string(performCount++));
   }
 
+  //! Gather the elements in conflict that are not part of a component yet
   void buildConnectedComponents_() {
-    for (const Entity& entity : elements(this->leafGridView())) {
-      if (entity.mightVanish()) {
-        const auto& hostEntity = entity.impl().hostEntity();
-        const IdType id = this->globalIdSet().id(entity);
-
-        bool found = false;
-        const std::size_t componentId = hostEntity->info().componentNumber - 1;
-
-        // check if component for entity exists already and add entity if
-        // necessary
-        if (componentId < connectedComponents_.size()) {
-          // sth. changed, we have to update the component to include this
-          // entity
-          if (!entity.isNew()) {
-            ConnectedComponent& component = connectedComponents_[componentId];
-            if (!component.hasEntity(entity)) component.update(entity);
-          }
+    if (connectedComponents_.size() + 1 < componentCount_)
+      connectedComponents_.resize(componentCount_ - 1);
+
+    for (const auto& hostEntity : conflictElements_) {
+      if (hostgrid_.is_infinite(hostEntity)) continue;
+      if (componentState_[hostEntity->info().index] !=
+          ConnectedComponent::pending)
+        continue;
+
+      const std::size_t componentNumber = hostEntity->info().componentNumber;
+      ConnectedComponent& component = connectedComponents_[componentNumber - 1];
+      if (component.size() == 0) component.reset(This(), componentNumber);
+      component.update(entity(hostEntity), componentState_);
+    }
+  }
 
-          vanishingEntityConnectedComponentMap_.insert(
-              std::make_pair(id, componentId));
-        }
-        // else create new component
-        else {
-          connectedComponents_[componentId] =
-              ConnectedComponent(This(), entity);
-          vanishingEntityConnectedComponentMap_.insert(
-              std::make_pair(id, componentId));
-        }
+  //! Gather the cells incident to interface vertices with non-zero shift into
+  //! stars, the flags in inStars are reset on return
+  void gatherMovedStars_(const std::vector<GlobalCoordinate>& shifts,
+                         std::vector<HostGridEntity<0>>& stars,
+                         std::vector<bool>& inStars) const {
+    const auto& iindexSet = this->interfaceGrid().leafIndexSet();
+    std::vector<VertexHandle> moved;
+    for (const auto& vertex : vertices(this->interfaceGrid().leafGridView()))
+      if (shifts[iindexSet.index(vertex)] != GlobalCoordinate(0.0))
+        moved.push_back(vertex.impl().hostEntity());
+
+    gatherStars_(moved, stars, inStars);
+  }
+
+  //! Gather the cells incident to the given vertices into stars, the flags in
+  //! inStars are reset on return
+  void gatherStars_(const std::vector<VertexHandle>& moved,
+                    std::vector<HostGridEntity<0>>& stars,
+                    std::vector<bool>& inStars) const {
+    inStars.resize(leafIndexSet_->size(0), false);
+    stars.clear();
+
+    for (const auto& vh : moved)
+      for (const auto& element : incidentElements(entity(vh))) {
+        const std::size_t index = leafIndexSet_->index(element);
+        if (inStars[index]) continue;
+        inStars[index] = true;
+        stars.push_back(element.impl().hostEntity());
       }
+
+    // reset the flags to keep this in O(size of the stars)
+    for (const auto& hostElement : stars)
+      inStars[hostElement->info().index] = false;
+  }
+
+  //! Compute the triangulations of the cut sets of the new elements
+  void computeCutSets_() {
+    using CutSetTriangulation = MMeshImpl::CutSetTriangulation<Entity>;
+    using Simplex = typename CutSetTriangulation::Simplex;
+
+    newElements_.clear();
+    for (const auto& element : elements(this->leafGridView()))
+      if (element.isNew()) newElements_.push_back(element.impl().hostEntity());
+    const std::size_t n = newElements_.size();
+
+    // the cut sets of chunks of consecutive new elements are computed in
+    // parallel and then gathered in the flat buffer
+    static constexpr std::size_t chunkSize = 64;
+    const std::size_t numChunks = (n + chunkSize - 1) / chunkSize;
+    if (cutSetChunks_.size() < numChunks) cutSetChunks_.resize(numChunks);
+
+    cutSetOffsets_.resize(n + 1);
+    cutSetOffsets_[0] = 0;
+    MMeshImpl::parallelFor(numChunks, [this, n](std::size_t c) {
+      auto& chunk = cutSetChunks_[c];
+      chunk.clear();
+
+      for (std::size_t i = c * chunkSize; i < std::min(n, (c + 1) * chunkSize);
+           ++i) {
+        const Entity element = entity(newElements_[i]);
+        for (const auto& old : element.impl().connectedComponent().children())
+          CutSetTriangulation::compute(old, element, [&](const Simplex& s) {
+            chunk.push_back({&old, s});
+          });
+
+        // the end of the cut set within the chunk
+        cutSetOffsets_[i + 1] = chunk.size();
+      }
+    });
+
+    std::size_t offset = 0;
+    for (std::size_t c = 0; c < numChunks; ++c) {
+      for (std::size_t i = c * chunkSize; i < std::min(n, (c + 1) * chunkSize);
+           ++i)
+        cutSetOffsets_[i + 1] += offset;
+      offset += cutSetChunks_[c].size();
+    }
+
+    cutSet_.resize(offset);
+    MMeshImpl::parallelFor(numChunks, [this](std::size_t c) {
+      std::copy(cutSetChunks_[c].begin(), cutSetChunks_[c].end(),
+                cutSet_.begin() + cutSetOffsets_[c * chunkSize]);
+    });
+
+    if (!parallelProjection_) return;
+
+    // sort the new elements by their component number
+    componentOffsets_.assign(componentCount_ + 1, 0);
+    for (const auto& hostEntity : newElements_) {
+      assert(hostEntity->info().componentNumber > 0);
+      componentOffsets_[hostEntity->info().componentNumber]++;
+    }
+    std::partial_sum(componentOffsets_.begin(), componentOffsets_.end(),
+                     componentOffsets_.begin());
+
+    componentElements_.resize(n);
+    for (std::size_t i = n; i-- > 0;) {
+      const std::size_t number = newElements_[i]->info().componentNumber;
+      componentElements_[--componentOffsets_[number]] = i;
     }
   }
 
@@ -1541,16 +2360,22 @@ class MMesh
   VertexHandle insertInInterface_(const RefinementInsertionPoint& ip) {
     assert(isInterface(ip.edge));
 
-    // get the vertex ids of the interface segment
-    std::vector<std::size_t> ids;
+    // get the vertices of the interface segment sorted by their ids
+    std::vector<VertexHandle> vhs;
     for (std::size_t i = 0; i < ip.edge.subEntities(dim); ++i)
-      ids.push_back(
-          globalIdSet().id(ip.edge.impl().template subEntity<dim>(i)).vt()[0]);
-    std::sort(ids.begin(), ids.end());
+      vhs.push_back(
+          ip.edge.impl().template subEntity<dim>(i).impl().hostEntity());
+    std::sort(vhs.begin(), vhs.end(), [](const auto& a, const auto& b) {
+      return a->info().id < b->info().id;
+    });
+
+    std::vector<std::size_t> ids;
+    for (const auto& v : vhs) ids.push_back(v->info().id);
 
     // erase old interface segment
     std::size_t marker = interfaceSegments_[ids];
     interfaceSegments_.erase(ids);
+    interfaceRegistry_.eraseSegment(ids);
 
     // insert the point
     auto eh = ip.edge.impl().hostEntity();
@@ -1564,12 +2389,17 @@ class MMesh
     std::vector<std::vector<std::size_t>> allNewIds;
     for (int i = 0; i < dimension; ++i) {
       std::vector<std::size_t> newIds;
+      typename InterfaceRegistry::Segment segment;
       newIds.push_back(id);
-      for (int j = 0; j < dimension - 1; ++j)
+      segment[0] = vh;
+      for (int j = 0; j < dimension - 1; ++j) {
         newIds.push_back(ids[(i + j) % dimension]);
+        segment[j + 1] = vhs[(i + j) % dimension];
+      }
 
       std::sort(newIds.begin(), newIds.end());
       interfaceSegments_.insert(std::make_pair(newIds, marker));
+      interfaceRegistry_.insertSegment(segment);
       allNewIds.push_back(newIds);
     }
 
@@ -1611,6 +2441,7 @@ class MMesh
       if (it != interfaceSegments_.end()) {
         marker = interfaceSegments_[ids];
         interfaceSegments_.erase(it);
+        interfaceRegistry_.eraseSegment(ids);
         otherVhs.push_back(other);
       }
     }
@@ -1618,6 +2449,8 @@ class MMesh
     if (otherVhs.size() != 2)
       return {};  // otherwise, we remove a tip or a junction
 
+    interfaceRegistry_.eraseVertex(vh);
+
     std::list<EdgeHandle> hole;
     hostgrid_.make_hole(vh, hole);
 
@@ -1629,6 +2462,7 @@ class MMesh
         {otherVhs[0]->info().id, otherVhs[1]->info().id}};
     std::sort(ids.begin(), ids.end());
     interfaceSegments_.insert(std::make_pair(ids, marker));
+    interfaceRegistry_.insertSegment({otherVhs[0], otherVhs[1]});
 
     // pass this refinement information to the interface grid
     interfaceGrid_->markAsRefined(/*children*/ {ids}, connectedComponent);
@@ -1639,7 +2473,124 @@ class MMesh
   template <int d = dimension>
   std::enable_if_t<d == 3, ElementOutput> removeFromInterface_(
       const VertexHandle& vh) {
-    DUNE_THROW(NotImplemented, "removeFromInterface() in 3d");
+    const auto ivertex = interfaceGrid_->entity(vh);
+    if (!RefinementStrategy::isRemoveable(ivertex))
+      return {};  // otherwise, we remove a tip or a junction
+
+    // collect the interface segments, vh is collapsed along an interface edge
+    InterfaceGridConnectedComponent connectedComponent;
+    std::vector<typename InterfaceRegistry::Segment> segments;
+    std::vector<VertexHandle> targets;
+    for (const auto& e : incidentInterfaceElements(ivertex)) {
+      // skip the vertex if its star overlaps an existing component, e.g. of a
+      // previous insertion or removal in this adaptation
+      if (interfaceGrid_->hasConnectedComponent(e)) return {};
+      connectedComponent.add(e);
+
+      typename InterfaceRegistry::Segment segment;
+      for (int i = 0; i < dimension; ++i) {
+        segment[i] = e.template subEntity<dimension - 1>(i).impl().hostEntity();
+        if (segment[i] != vh) targets.push_back(segment[i]);
+      }
+      segments.push_back(segment);
+    }
+    std::sort(targets.begin(), targets.end());
+    targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+
+    // the interface has to stay a manifold with similar normals: the common
+    // interface neighbors of vh and the target are the apexes of the segments
+    // at the collapsed edge and the rewritten segments turn by at most 30
+    // degrees
+    static constexpr double minCosine = 0.8660254037844386;
+    auto normal = [](const auto& segment) {
+      std::array<GlobalCoordinate, 3> x;
+      for (int i = 0; i < 3; ++i) x[i] = makeFieldVector(segment[i]->point());
+      const GlobalCoordinate a = x[1] - x[0], b = x[2] - x[0];
+      return GlobalCoordinate{a[1] * b[2] - a[2] * b[1],
+                              a[2] * b[0] - a[0] * b[2],
+                              a[0] * b[1] - a[1] * b[0]};
+    };
+    auto contains = [](const auto& segment, const VertexHandle& v) {
+      return std::find(segment.begin(), segment.end(), v) != segment.end();
+    };
+
+    std::vector<VertexHandle> validTargets;
+    for (const auto& w : targets) {
+      std::vector<VertexHandle> apexes;
+      for (const auto& segment : segments)
+        if (contains(segment, w))
+          for (const auto& x : segment)
+            if (x != vh && x != w) apexes.push_back(x);
+
+      std::vector<VertexHandle> common;
+      for (const auto& x :
+           incidentInterfaceVertices(interfaceGrid_->entity(w))) {
+        const VertexHandle& xh = x.impl().hostEntity();
+        if (xh != w && std::binary_search(targets.begin(), targets.end(), xh))
+          common.push_back(xh);
+      }
+
+      std::sort(apexes.begin(), apexes.end());
+      std::sort(common.begin(), common.end());
+      if (common != apexes) continue;
+
+      bool valid = true;
+      for (const auto& segment : segments) {
+        if (contains(segment, w)) continue;
+
+        auto rewritten = segment;
+        std::replace(rewritten.begin(), rewritten.end(), vh, w);
+        const GlobalCoordinate n0 = normal(segment), n1 = normal(rewritten);
+        if (n0 * n1 <= minCosine * n0.two_norm() * n1.two_norm()) {
+          valid = false;
+          break;
+        }
+      }
+      if (valid) validTargets.push_back(w);
+    }
+
+    const VertexHandle target = hostgrid_.collapseTarget(vh, validTargets);
+    if (target == VertexHandle()) return {};
+
+    // remove the interface segments
+    auto segmentIds = [](const auto& segment) {
+      std::vector<std::size_t> ids;
+      for (const auto& v : segment) ids.push_back(v->info().id);
+      std::sort(ids.begin(), ids.end());
+      return ids;
+    };
+
+    std::vector<std::size_t> markers;
+    for (const auto& segment : segments) {
+      const auto ids = segmentIds(segment);
+      auto it = interfaceSegments_.find(ids);
+      markers.push_back(it != interfaceSegments_.end() ? it->second : 1);
+      if (it != interfaceSegments_.end()) interfaceSegments_.erase(it);
+      interfaceRegistry_.eraseSegment(ids);
+    }
+    interfaceRegistry_.eraseVertex(vh);
+
+    ElementOutput elements;
+    hostgrid_.collapseAndGiveNewElements(vh, target, elements);
+
+    // the segments at the collapsed edge vanish, the others keep their marker
+    std::vector<std::vector<std::size_t>> children;
+    for (std::size_t i = 0; i < segments.size(); ++i) {
+      auto segment = segments[i];
+      if (std::find(segment.begin(), segment.end(), target) != segment.end())
+        continue;
+
+      std::replace(segment.begin(), segment.end(), vh, target);
+      const auto ids = segmentIds(segment);
+      interfaceSegments_.insert(std::make_pair(ids, markers[i]));
+      interfaceRegistry_.insertSegment(segment);
+      children.push_back(ids);
+    }
+
+    // pass this refinement information to the interface grid
+    interfaceGrid_->markAsRefined(children, connectedComponent);
+
+    return elements;
   }
 
  public:
@@ -1762,12 +2713,11 @@ class MMesh
   const auto& interfaceGridPtr() { return interfaceGrid_; }
 
   const ConnectedComponent& getConnectedComponent(const Entity& entity) const {
-    const auto& it = createdEntityConnectedComponentMap_.find(
-        this->globalIdSet().id(entity));
-    assert(it->second < connectedComponents_.size());
-    assert(it != createdEntityConnectedComponentMap_.end());
-    assert(connectedComponents_.at(it->second).size() > 0);
-    return connectedComponents_.at(it->second);
+    const std::size_t componentNumber =
+        entity.impl().hostEntity()->info().componentNumber;
+    assert(componentNumber > 0 && componentNumber < componentCount_);
+    assert(connectedComponents_[componentNumber - 1].size() > 0);
+    return connectedComponents_[componentNumber - 1];
   }
 
   const RemeshingIndicator& indicator() const { return indicator_; }
@@ -1784,19 +2734,52 @@ class MMesh
 
  private:
   // count how much elements where marked
-  mutable int coarsenMarked_;
-  mutable int refineMarked_;
-  mutable std::size_t componentCount_;
+  mutable std::atomic<int> coarsenMarked_{0};
+  mutable std::atomic<int> refineMarked_{0};
+  mutable std::size_t componentCount_ = 1;
+
+  //! The elements and indicator values of markElements()
+  std::vector<HostGridEntity<0>> markElements_;
+  std::vector<std::int8_t> indicatorValues_;
+
+  //! The component sets and the elements in conflict during adapt_()
+  MMeshUnionFind componentSets_;
+  std::vector<HostGridEntity<0>> conflictElements_;
+
+  //! The connected components indexed by the component number - 1, they are
+  //! reset but not freed by postAdapt()
+  std::vector<ConnectedComponent> connectedComponents_;
+  std::vector<std::uint8_t> componentState_;
+
+  //! The cells incident to moved interface vertices
+  std::vector<HostGridEntity<0>> movedStars_;
+  std::vector<bool> inMovedStars_;
+
+  //! The cells whose cached geometries are refreshed after a movement
+  std::vector<HostGridEntity<0>> cacheStars_;
+
+  //! A simplex of the cut set of a new element with one of its fathers
+  struct CutSetSimplex {
+    const CachingEntity* father;
+    std::array<GlobalCoordinate, dimension + 1> corners;
+  };
 
-  //! The storage of the connected components of entities
-  std::unordered_map<IdType, ConnectedComponent> connectedComponents_;
+  //! The simplices of the cut sets of the new elements during adapt(handle),
+  //! the cut set of the new element i is [cutSetOffsets_[i], [i + 1])
+  std::vector<HostGridEntity<0>> newElements_;
+  std::vector<CutSetSimplex> cutSet_;
+  std::vector<std::size_t> cutSetOffsets_;
+  std::vector<std::vector<CutSetSimplex>> cutSetChunks_;
 
-  //! Maps the entities to its connected components
-  std::unordered_map<IdType, std::size_t> vanishingEntityConnectedComponentMap_;
-  std::unordered_map<IdType, std::size_t> createdEntityConnectedComponentMap_;
+  //! The new elements sorted by component for the parallel projection
+  bool parallelProjection_ = false;
+  std::vector<std::size_t> componentElements_;
+  std::vector<std::size_t> componentOffsets_;
 
   Communication<Comm> comm_;
   PartitionHelper<GridImp> partitionHelper_;
+  InterfaceRegistry interfaceRegistry_;
+  GeometryCache geometryCache_;
 
   std::unique_ptr<MMeshLeafIndexSet<const GridImp>> leafIndexSet_;
   std::unique_ptr<MMeshGlobalIdSet<const GridImp>> globalIdSet_;
@@ -1806,6 +2789,7 @@ class MMesh
   std::unordered_set<IdType> inserted_;
   std::vector<VertexHandle> remove_;
   std::unordered_set<IdType> removed_;
+  std::vector<Flip> flip_;
 
   //! The host grid which contains the actual grid hierarchy structure
   HostGrid hostgrid_;
@@ -1817,22 +2801,60 @@ class MMesh
   static const bool verbose_ = false;
   int sequence_ = 0;
 
- private:
-  //! Flag all elements in conflict as mightVanish
-  bool markElementsForInsertion_(const Edge& edge,
-                                 std::size_t& componentNumber) {
-    ElementOutput elements;
-    getIncidentToEdge_(edge, elements);
+  //! Incremental bookkeeping during adaptation
+  bool incrementalAdapt_ = false;
+  bool tracking_ = false;
+  mutable std::vector<HostGridEntity<0>> touched_;
 
-    bool markAgain = getComponentNumber_(elements, componentNumber);
+  //! Geometry caching
+  bool cacheGeometry_ = false;
 
-    // set componentNumber and mightVanish
-    for (const auto& element : elements) {
-      element->info().componentNumber = componentNumber;
-      element->info().mightVanish = true;
+  //! Refill the geometry cache if it is enabled
+  void updateGeometryCache_() {
+    if (cacheGeometry_)
+      geometryCache_.update();
+    else if (geometryCache_.size() > 0)
+      geometryCache_.clear();
+  }
+
+  //! Refresh only the cells incident to moved vertices if the cache is valid
+  void updateGeometryCache_(const std::vector<VertexHandle>& moved) {
+    if (!cacheGeometry_ || !geometryCache_.valid()) {
+      updateGeometryCache_();
+      return;
     }
 
-    return markAgain;
+    gatherStars_(moved, cacheStars_, inMovedStars_);
+    geometryCache_.update(cacheStars_);
+  }
+
+  //! Return if the bookkeeping can be updated incrementally
+  bool incremental_() const {
+    return incrementalAdapt_ && comm().size() == 1;
+  }
+
+  //! Remember an element that carries markers until postAdapt
+  void touch_(const HostGridEntity<0>& element) const {
+    if (tracking_ && !hostgrid_.is_infinite(element))
+      touched_.push_back(element);
+  }
+
+  //! Return if a handle refers to an element of the host grid
+  bool ownsElement_(const HostGridEntity<0>& element) const {
+    if constexpr (dim == 2)
+      return hostgrid_.tds().faces().owns(element) &&
+             !hostgrid_.is_infinite(element);
+    else
+      return hostgrid_.tds().cells().owns(element) &&
+             !hostgrid_.is_infinite(element);
+  }
+
+ private:
+  //! Flag all elements in conflict as mightVanish
+  void markElementsForInsertion_(const Edge& edge, std::size_t label) {
+    ElementOutput elements;
+    getIncidentToEdge_(edge, elements);
+    markConflict_(elements, label);
   }
 
   /// @cond
@@ -1852,23 +2874,29 @@ class MMesh
     for (std::size_t i = 0; i < CGAL::circulator_size(cit); ++i, ++cit)
       elements.push_back(cit);
   }
+
+  template <int d = dimension>
+  std::enable_if_t<d == 2, void> getIncidentToVertex_(
+      const VertexHandle& vh, ElementOutput& elements) const {
+    auto fit = this->getHostGrid().incident_faces(vh);
+    const auto fend = fit;
+    do
+      elements.push_back(fit);
+    while (++fit != fend);
+  }
+
+  template <int d = dimension>
+  std::enable_if_t<d == 3, void> getIncidentToVertex_(
+      const VertexHandle& vh, ElementOutput& elements) const {
+    this->getHostGrid().incident_cells(vh, std::back_inserter(elements));
+  }
   /// @endcond
 
   //! Flag element in conflict with point
-  bool markElementForInsertion_(const Point& point,
-                                std::size_t& componentNumber) {
+  void markElementForInsertion_(const Point& point, std::size_t label) {
     ElementOutput elements;
     elements.push_back(this->getHostGrid().locate(point));
-
-    bool markAgain = getComponentNumber_(elements, componentNumber);
-
-    // set componentNumber and mightVanish
-    for (const auto& element : elements) {
-      element->info().componentNumber = componentNumber;
-      element->info().mightVanish = true;
-    }
-
-    return markAgain;
+    markConflict_(elements, label);
   }
 
   //! Flag all incident elements as new
@@ -1877,28 +2905,16 @@ class MMesh
     for (const auto& element : incidentElements(entity(vh))) {
       element.impl().hostEntity()->info().isNew = true;
       element.impl().hostEntity()->info().componentNumber = componentId + 1;
-      const IdType id = this->globalIdSet().id(element);
-      this->createdEntityConnectedComponentMap_.insert(
-          std::make_pair(id, componentId));
     }
   }
 
   //! Flag all incident elements as mightVanish
-  bool markElementsForRemoval_(const HostGridEntity<dimension>& vh,
-                               std::size_t& componentNumber) {
+  void markElementsForRemoval_(const HostGridEntity<dimension>& vh,
+                               std::size_t label) {
     ElementOutput elements;
     for (const auto& element : incidentElements(entity(vh)))
       elements.push_back(element.impl().hostEntity());
-
-    bool markAgain = getComponentNumber_(elements, componentNumber);
-
-    // set componentNumber and mightVanish
-    for (const auto& element : elements) {
-      element->info().componentNumber = componentNumber;
-      element->info().mightVanish = true;
-    }
-
-    return markAgain;
+    markConflict_(elements, label);
   }
 
   //! Flag all elements in conflict as new
@@ -1908,36 +2924,27 @@ class MMesh
     for (const auto& element : elements) {
       element->info().isNew = true;
       element->info().componentNumber = componentId + 1;
-
-      const auto id = this->globalIdSet().id(this->entity(element));
-      this->createdEntityConnectedComponentMap_.insert(
-          std::make_pair(id, componentId));
     }
   }
 
-  //! Get the component number for a given set of elements
-  bool getComponentNumber_(const ElementOutput& elements,
-                           std::size_t& componentNumber) const {
-    bool markAgain = false;
-    componentNumber = 0;
-
-    // search for a componentNumber
-    for (const auto& element : elements)
-      if (element->info().componentNumber > 0) {
-        // check if we find different component numbers
-        if (componentNumber != 0 &&
-            element->info().componentNumber != componentNumber) {
-          markAgain = true;
-          componentNumber =
-              std::min(element->info().componentNumber, componentNumber);
-        } else
-          componentNumber = element->info().componentNumber;
-      }
+  //! Flag the elements as mightVanish and unite their components with the
+  //! component of the given label
+  void markConflict_(const ElementOutput& elements, std::size_t label) {
+    for (const auto& element : elements) {
+      // elements of the old grid that might vanish the first time have to be
+      // added to a component
+      if (!element->info().mightVanish && !element->info().isNew &&
+          !hostgrid_.is_infinite(element))
+        componentState_[element->info().index] = ConnectedComponent::pending;
 
-    // if no componentNumber was found, create a new one
-    if (componentNumber == 0) componentNumber = componentCount_++;
+      const std::size_t componentNumber = element->info().componentNumber;
+      if (componentNumber > 0) componentSets_.unite(componentNumber, label);
 
-    return markAgain;
+      element->info().componentNumber = label;
+      element->info().mightVanish = true;
+      touch_(element);
+      conflictElements_.push_back(element);
+    }
   }
 
 };  // end Class MMesh
@@ -7,47 +7,57 @@
  * \brief The multi id class
  */
 
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+#include <vector>
+
 #include <dune/mmesh/grid/common.hh>
 
 namespace Dune {
 namespace MMeshImpl {
 
+/** \brief Id of an entity given by the (sorted) ids of its vertices
+ *
+ *  The vertex ids are stored in a fixed-size array, hence, a MultiId is
+ *  trivially copyable and never allocates. As all codimensions share the
+ *  same id type, the number of vertex ids is stored at runtime.
+ */
 class MultiId {
  public:
   using ThisType = MultiId;
   using T = std::size_t;
   using VT = std::vector<T>;
 
+  //! Maximal number of vertex ids, i.e. the vertices of a tetrahedron
+  static constexpr std::size_t capacity = 4;
+
   // we use an array as internal storage to make MultiId trivially copyable
-  using Storage = std::array<T, 4>;
+  using Storage = std::array<T, capacity>;
 
-  MultiId() : size_(0), hash_(-1) {}
+  using const_iterator = const T*;
 
-  MultiId(const MultiId& other)
-      : vt_(other.vt_), size_(other.size_), hash_(other.hash_) {}
+  MultiId() : vt_{}, size_(0) {}
 
-  MultiId(const std::vector<T>& vt) : size_(vt.size()), hash_(-1) {
-    int i = 0;
-    for (const auto& v : vt) vt_[i++] = v;
+  //! Construct from the ids of the n vertices of an entity
+  template <std::size_t n>
+  MultiId(const std::array<T, n>& ids) : vt_{}, size_(n) {
+    static_assert(n <= capacity, "Too many ids for a MultiId");
+    for (std::size_t i = 0; i < n; ++i) vt_[i] = ids[i];
   }
 
-  MultiId(std::initializer_list<T> l) : MultiId(std::vector<T>(l)) {}
+  MultiId(const std::vector<T>& vt) : MultiId(vt.data(), vt.size()) {}
 
-  MultiId(T t) : MultiId({t}) {}
+  MultiId(std::initializer_list<T> l) : MultiId(l.begin(), l.size()) {}
 
-  ThisType& operator=(const ThisType& b) {
-    if (this != &b) {
-      vt_ = b.vt_;
-      size_ = b.size_;
-      hash_ = b.hash_;
-    }
-    return *this;
-  }
+  MultiId(T t) : vt_{t}, size_(1) {}
 
   bool operator<(const ThisType& b) const {
     if (size() != b.size()) return size() < b.size();
 
-    for (int i = 0; i < size_; ++i)
+    for (std::size_t i = 0; i < size_; ++i)
       if (vt_[i] != b.vt_[i]) return vt_[i] < b.vt_[i];
 
     return false;
@@ -56,7 +66,7 @@ class MultiId {
   bool operator==(const ThisType& b) const {
     if (size() != b.size()) return false;
 
-    for (int i = 0; i < size_; ++i)
+    for (std::size_t i = 0; i < size_; ++i)
       if (vt_[i] != b.vt_[i]) return false;
 
     return true;
@@ -68,35 +78,50 @@ class MultiId {
 
   std::size_t size() const { return size_; }
 
-  VT vt() const {
-    std::vector<T> vec;
-    vec.reserve(size_);
-    for (int i = 0; i < size_; ++i) vec.push_back(vt_[i]);
-    return vec;
+  //! Return the i-th vertex id
+  T operator[](std::size_t i) const {
+    assert(i < size_);
+    return vt_[i];
   }
 
-  //! Hash function with caching
+  //! Range of the vertex ids
+  const_iterator begin() const { return vt_.data(); }
+  const_iterator end() const { return vt_.data() + size_; }
+
+  //! Return the vertex ids as a vector, prefer operator[] or begin/end
+  VT vt() const { return VT(begin(), end()); }
+
+  //! Hash function mixing all bits of the vertex ids
   std::size_t hash() const {
-    if (hash_ == std::size_t(-1)) {
-      if (size_ == 0) {
-        hash_ = 0;
-        return hash_;
-      }
-
-      static constexpr std::hash<std::size_t> hasher;
-      hash_ = hasher(vt_[0]);
-      for (std::size_t i = 1; i < size_; ++i)
-        hash_ = hash_ ^ (hasher(vt_[i]) << i);
-    }
-    return hash_;
+    std::uint64_t h = size_;
+    for (std::size_t i = 0; i < size_; ++i)
+      h = mix_(h ^ (vt_[i] + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2)));
+    return h;
   }
 
  private:
+  MultiId(const T* ids, std::size_t size) : vt_{}, size_(size) {
+    assert(size <= capacity);
+    for (std::size_t i = 0; i < size; ++i) vt_[i] = ids[i];
+  }
+
+  //! The finalizer of splitmix64
+  static std::uint64_t mix_(std::uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+  }
+
   Storage vt_;
-  std::size_t size_;
-  mutable std::size_t hash_;
+  std::uint8_t size_;
 };
 
+static_assert(std::is_trivially_copyable<MultiId>::value,
+              "MultiId should be trivially copyable");
+
 }  // end namespace MMeshImpl
 }  // end namespace Dune
 
@@ -112,7 +137,7 @@ struct hash<Dune::MMeshImpl::MultiId> {
 //! overload operator<<
 inline ostream& operator<<(ostream& os,
                            const Dune::MMeshImpl::MultiId& multiId) {
-  for (const auto& v : multiId.vt()) os << v << " ";
+  for (const auto& v : multiId) os << v << " ";
   return os;
 }
 }  // namespace std
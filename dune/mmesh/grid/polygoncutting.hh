@@ -3,11 +3,18 @@
 
 #include <algorithm>
 #include <iostream>
+#include <vector>
+
+#include <dune/mmesh/misc/smallvector.hh>
 
 namespace Dune {
 template <class Scalar, class Point>
 class PolygonCutting {
  public:
+  // polygon with inline storage for the corners, the cut of two triangles
+  // has at most six corners and only larger polygons are stored on the heap
+  using StaticPolygon = MMeshSmallVector<Point, 8>;
+
   // implements the Sutherland-Hodgman algorithm to determine the polygon that
   // emerges from clipping a subject polygon with respect to the edges of a
   // clip polygon, subject polygon and clip polygon as well as the resulting
@@ -15,12 +22,22 @@ class PolygonCutting {
   // arranged in a consecutive counterclockwise order
   template <typename Polygon>
   static std::vector<Point> sutherlandHodgman(const Polygon& subjectPolygon,
-                                              const Polygon& clipPolygonInput) {
-    std::vector<Point> outputPolygon(subjectPolygon.begin(),
-                                     subjectPolygon.end());
-    std::vector<Point> clipPolygon(clipPolygonInput.begin(),
-                                   clipPolygonInput.end());
+                                              const Polygon& clipPolygon) {
+    StaticPolygon outputPolygon;
+    sutherlandHodgman(subjectPolygon, clipPolygon, outputPolygon);
+    return std::vector<Point>(outputPolygon.begin(), outputPolygon.end());
+  }
 
+  // same as above, but writes the resulting polygon to outputPolygon which
+  // can be a StaticPolygon to avoid any heap allocation
+  template <typename Subject, typename Clip, typename Output>
+  static void sutherlandHodgman(const Subject& subjectPolygon,
+                                const Clip& clipPolygon,
+                                Output& outputPolygon) {
+    outputPolygon.clear();
+    for (const auto& p : subjectPolygon) outputPolygon.push_back(p);
+
+    StaticPolygon inputPolygon;
     const int clipSize = clipPolygon.size();
 
     // iterate over the edges of the clipping polygon represented by
@@ -28,7 +45,8 @@ class PolygonCutting {
     for (int clipIdx = 0; clipIdx < clipSize; clipIdx++) {
       const int clipIdxNext = (clipIdx + 1) % clipSize;
 
-      std::vector<Point> inputPolygon(outputPolygon);
+      inputPolygon.clear();
+      for (const auto& p : outputPolygon) inputPolygon.push_back(p);
       outputPolygon.clear();
       const int inputSize = inputPolygon.size();
 
@@ -91,8 +109,6 @@ class PolygonCutting {
         }
       }
     }
-
-    return outputPolygon;
   }
 
   // computes the point of intersection in 2d between the line given by the
@@ -0,0 +1,111 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_MMESH_GRID_SPACEFILLINGCURVE_HH
+#define DUNE_MMESH_GRID_SPACEFILLINGCURVE_HH
+
+/** \file
+ * \brief The MMeshSpaceFillingCurve class
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+// Dune includes
+#include <dune/common/fvector.hh>
+
+namespace Dune {
+
+//! Numbering of the leaf elements and vertices
+enum class MMeshOrdering {
+  none,    //!< the order of the host grid storage
+  morton,  //!< along the Morton (z-order) curve
+  hilbert  //!< along the Hilbert curve
+};
+
+/** \brief Keys of points along a space-filling curve
+ *  \ingroup MMesh
+ *
+ *  The points are scaled to an integer grid inside the given bounding box
+ *  and the key is obtained by interleaving the bits of the coordinates. For
+ *  the Hilbert curve, the coordinates are transformed before following
+ *  J. Skilling, Programming the Hilbert curve, AIP Conf. Proc. 707 (2004).
+ */
+template <int dim>
+class MMeshSpaceFillingCurve {
+ public:
+  using Key = std::uint64_t;
+  using GlobalCoordinate = FieldVector<double, dim>;
+
+  //! Number of bits per coordinate
+  static constexpr int bits = 64 / dim;
+
+  MMeshSpaceFillingCurve(MMeshOrdering ordering, const GlobalCoordinate& lower,
+                         const GlobalCoordinate& upper)
+      : ordering_(ordering), lower_(lower) {
+    const double max = double((std::uint64_t(1) << bits) - 1);
+    for (int i = 0; i < dim; ++i) {
+      const double extent = upper[i] - lower[i];
+      scale_[i] = (extent > 0.0) ? max / extent : 0.0;
+    }
+  }
+
+  //! Return the key of x
+  Key operator()(const GlobalCoordinate& x) const {
+    const double max = double((std::uint64_t(1) << bits) - 1);
+
+    std::array<std::uint64_t, dim> c;
+    for (int i = 0; i < dim; ++i) {
+      const double s = std::clamp((x[i] - lower_[i]) * scale_[i], 0.0, max);
+      c[i] = std::uint64_t(s);
+    }
+
+    if (ordering_ == MMeshOrdering::hilbert) axesToTranspose_(c);
+
+    return interleave_(c);
+  }
+
+ private:
+  //! Transform the coordinates to the transposed Hilbert index
+  static void axesToTranspose_(std::array<std::uint64_t, dim>& x) {
+    const std::uint64_t m = std::uint64_t(1) << (bits - 1);
+
+    // inverse undo
+    for (std::uint64_t q = m; q > 1; q >>= 1) {
+      const std::uint64_t p = q - 1;
+      for (int i = 0; i < dim; ++i)
+        if (x[i] & q)
+          x[0] ^= p;
+        else {
+          const std::uint64_t t = (x[0] ^ x[i]) & p;
+          x[0] ^= t;
+          x[i] ^= t;
+        }
+    }
+
+    // gray encode
+    for (int i = 1; i < dim; ++i) x[i] ^= x[i - 1];
+
+    std::uint64_t t = 0;
+    for (std::uint64_t q = m; q > 1; q >>= 1)
+      if (x[dim - 1] & q) t ^= q - 1;
+
+    for (int i = 0; i < dim; ++i) x[i] ^= t;
+  }
+
+  //! Interleave the bits of the coordinates, most significant first
+  static Key interleave_(const std::array<std::uint64_t, dim>& x) {
+    Key key = 0;
+    for (int b = bits - 1; b >= 0; --b)
+      for (int i = 0; i < dim; ++i) key = (key << 1) | ((x[i] >> b) & 1);
+    return key;
+  }
+
+  MMeshOrdering ordering_;
+  GlobalCoordinate lower_;
+  GlobalCoordinate scale_;
+};
+
+}  // namespace Dune
+
+#endif
@@ -0,0 +1,142 @@
+#ifndef DUNE_MMESH_GRID_TETRAHEDRONCUTTING_HH
+#define DUNE_MMESH_GRID_TETRAHEDRONCUTTING_HH
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include <dune/mmesh/misc/smallvector.hh>
+
+namespace Dune {
+template <class Scalar, class Point>
+class TetrahedronCutting {
+ public:
+  using Tetrahedron = std::array<Point, 4>;
+
+  // list of tetrahedra with inline storage, the cut of two tetrahedra is
+  // decomposed into few tetrahedra and only larger lists are stored on the heap
+  using StaticTetrahedra = MMeshSmallVector<Tetrahedron, 16>;
+
+  // clips the subject tetrahedron with the half-spaces bounded by the faces
+  // of the clip tetrahedron, the resulting convex polyhedron is written to
+  // output as a list of tetrahedra (analogous to the Sutherland-Hodgman
+  // algorithm, but the pieces are kept as tetrahedra after each clip)
+  template <typename Output>
+  static void clip(const Tetrahedron& subject, const Tetrahedron& clipTet,
+                   Output& output) {
+    output.clear();
+    output.push_back(subject);
+
+    StaticTetrahedra input;
+    for (int k = 0; k < 4 && output.size() > 0; ++k) {
+      // unit outer normal of the face opposite to vertex k
+      const Point& q = clipTet[(k + 1) % 4];
+      Point normal = cross(clipTet[(k + 2) % 4] - q, clipTet[(k + 3) % 4] - q);
+      if (normal * (clipTet[k] - q) > 0.0) normal *= -1.0;
+      normal /= normal.two_norm();
+
+      input.clear();
+      for (const auto& t : output) input.push_back(t);
+      output.clear();
+
+      for (const auto& t : input) clipWithPlane(t, normal, q, output);
+    }
+  }
+
+  // clips the tetrahedron t with the half-space (x - q) * normal <= 0 and
+  // appends the tetrahedra of the remaining part to output
+  template <typename Output>
+  static void clipWithPlane(const Tetrahedron& t, const Point& normal,
+                            const Point& q, Output& output) {
+    // signed distances of the corners to the plane, d > 0 => outside
+    std::array<Scalar, 4> d;
+    Scalar minDist = 0.0, maxDist = 0.0;
+    for (int i = 0; i < 4; ++i) {
+      d[i] = normal * (t[i] - q);
+      minDist = std::min(minDist, d[i]);
+      maxDist = std::max(maxDist, d[i]);
+    }
+
+    static constexpr double EPSILON = 1e-14;
+    // case 1: all points inside or on the plane
+    if (maxDist <= EPSILON) {
+      output.push_back(t);
+      return;
+    }
+
+    // case 2: all points outside or on the plane
+    if (minDist >= -EPSILON) return;
+
+    std::array<int, 4> in, out;
+    int numIn = 0, numOut = 0;
+    for (int i = 0; i < 4; ++i)
+      if (d[i] > 0.0)
+        out[numOut++] = i;
+      else
+        in[numIn++] = i;
+
+    // intersection point of the edge (a, b) with the plane
+    auto cut = [&](int a, int b) {
+      Point x = t[a];
+      x.axpy(d[a] / (d[a] - d[b]), t[b] - t[a]);
+      return x;
+    };
+
+    // case 3: one point inside, the remaining part is a tetrahedron
+    if (numIn == 1) {
+      const int a = in[0];
+      output.push_back(
+          {t[a], cut(a, out[0]), cut(a, out[1]), cut(a, out[2])});
+    }
+
+    // case 4: two points inside, the remaining part is a wedge
+    else if (numIn == 2) {
+      const int a = in[0], b = in[1];
+      appendPrism(t[a], cut(a, out[0]), cut(a, out[1]), t[b], cut(b, out[0]),
+                  cut(b, out[1]), output);
+    }
+
+    // case 5: three points inside, the corner of the outside point is cut off
+    else {
+      const int a = in[0], b = in[1], c = in[2], o = out[0];
+      appendPrism(t[a], t[b], t[c], cut(a, o), cut(b, o), cut(c, o), output);
+    }
+  }
+
+  // appends the three tetrahedra of the convex prism with the triangles
+  // (x0, x1, x2) and (y0, y1, y2) where xi and yi are connected by an edge
+  template <typename Output>
+  static void appendPrism(const Point& x0, const Point& x1, const Point& x2,
+                          const Point& y0, const Point& y1, const Point& y2,
+                          Output& output) {
+    output.push_back({x0, x1, x2, y0});
+    output.push_back({x1, x2, y0, y1});
+    output.push_back({x2, y0, y1, y2});
+  }
+
+  // computes the volume of a tetrahedron
+  static Scalar volume(const Tetrahedron& t) {
+    const Point a = t[1] - t[0];
+    return std::abs(a * cross(t[2] - t[0], t[3] - t[0])) / 6.0;
+  }
+
+  // computes the intersection volume of two tetrahedra
+  static Scalar intersectionVolume(const Tetrahedron& subject,
+                                   const Tetrahedron& clipTet) {
+    StaticTetrahedra tetrahedra;
+    clip(subject, clipTet, tetrahedra);
+
+    Scalar sum = 0.0;
+    for (const auto& t : tetrahedra) sum += volume(t);
+    return sum;
+  }
+
+ private:
+  static Point cross(const Point& a, const Point& b) {
+    return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+            a[0] * b[1] - a[1] * b[0]};
+  }
+};
+}  // namespace Dune
+
+#endif
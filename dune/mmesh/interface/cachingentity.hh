@@ -128,15 +128,8 @@ class MMeshInterfaceCachingEntity<0, dim, GridImp>
   //! Return the number of subEntities of codimension cc
   unsigned int subEntities(unsigned int cc) const {
     // we have a simplex grid
-    int n = dim + 1;
-    int k = dim - cc + 1;
-
-    // binomial: n over k
-    int binomial = 1;
-    for (int i = n - k + 1; i <= n; i++) binomial *= i;
-    for (long i = 2; i <= k; i++) binomial /= i;
-
-    return binomial;
+    static constexpr auto sizes = MMeshImpl::simplexSubEntities<dim, 0>();
+    return sizes[cc];
   }
 
   //! returns true if Entity has no children
@@ -659,7 +659,7 @@ class MMeshInterfaceGridEntity<0, dim, GridImp>
   IdType id() const {
     // cache id
     if (id_ == IdType()) {
-      typename IdType::VT idlist(dim + 1);
+      std::array<typename IdType::T, dim + 1> idlist;
       for (std::size_t i = 0; i < this->subEntities(dim); ++i)
         if (grid_->canBeMirrored(hostEntity_))
           idlist[i] = this->subEntity<dim>(i).impl().hostEntity()->info().id;
@@ -511,20 +511,14 @@ class MMeshInterfaceGrid
 
   //! Return if interface segment is part of the interface
   bool isInterface(const MMeshInterfaceEntity<0>& segment) const {
-    int count = mMesh_->interfaceSegments().count(getVertexIds_(segment));
-    assert(count <= 1);
-    return (count > 0);
+    return MMesh::InterfaceRegistry::isInterface(segment);
   }
 
   //! Return if an edge is of the interface
   template <int d = dimension>
   std::enable_if_t<d == 2, bool> isInterface(
       const MMeshInterfaceEntity<1>& edge) const {
-    auto circulator = mMesh_->getHostGrid().incident_facets(edge);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         ++i, ++circulator)
-      if (isInterface(*circulator)) return true;
-    return false;
+    return MMesh::InterfaceRegistry::isInterface(edge);
   }
 
   //! Return if vertex is part of the interface
@@ -192,6 +192,7 @@ class GridFactory<MMeshInterfaceGrid<MMeshImp> >
   }
 
   auto getGrid() {
+    mMesh_->updateInterfaceRegistry();
     mMesh_->interfaceGridPtr()->setIds();
     mMesh_->interfaceGridPtr()->setIndices();
     mMesh_->interfaceGridPtr()->setBoundarySegments(boundarySegments_);
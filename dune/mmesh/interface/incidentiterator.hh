@@ -10,6 +10,9 @@
 // Dune includes
 #include <dune/grid/common/gridenums.hh>
 
+// MMesh includes
+#include <dune/mmesh/grid/incidentiterator.hh>
+
 namespace Dune {
 
 /** \brief Iterator over all incident interface vertices
@@ -35,7 +38,7 @@ class MMeshIncidentInterfaceVerticesIteratorImp<GridImp, 1> {
 
   //! The type of the element circulator
   using Circulator = typename GridImp::HostGridType::Vertex_circulator;
-  using ElementContainer = std::vector<HostGridVertex>;
+  using Circulation = MMeshImpl::StarCirculation<Circulator>;
 
  public:
   enum { codimension = 1 };
@@ -44,13 +47,9 @@ class MMeshIncidentInterfaceVerticesIteratorImp<GridImp, 1> {
 
   explicit MMeshIncidentInterfaceVerticesIteratorImp(
       const GridImp* igrid, const HostGridVertex& hostEntity)
-      : mMesh_(&igrid->getMMesh()), i_(0) {
-    Circulator circulator = mMesh_->getHostGrid().incident_vertices(hostEntity);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         ++i, ++circulator)
-      if (circulator->info().isInterface)
-        elementContainer_.push_back(circulator);
-  }
+      : mMesh_(&igrid->getMMesh()),
+        circulation_(mMesh_->getHostGrid().incident_vertices(hostEntity),
+                     accept) {}
 
   /** \brief Constructor which creates the end iterator
    *  \param endDummy      Here only to distinguish it from the other
@@ -58,30 +57,27 @@ class MMeshIncidentInterfaceVerticesIteratorImp<GridImp, 1> {
    */
   explicit MMeshIncidentInterfaceVerticesIteratorImp(
       const GridImp* igrid, const HostGridVertex& hostEntity, bool endDummy)
-      : mMesh_(&igrid->getMMesh()), i_(0) {
-    Circulator circulator = mMesh_->getHostGrid().incident_vertices(hostEntity);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         ++i, ++circulator)
-      if (circulator->info().isInterface) ++i_;
-  }
+      : mMesh_(&igrid->getMMesh()) {}
 
   //! prefix increment
-  void increment() { ++i_; }
+  void increment() { circulation_.increment(accept); }
 
   //! dereferencing
   Entity dereference() const {
-    return Entity{{&mMesh_->interfaceGrid(), elementContainer_[i_]}};
+    return Entity{{&mMesh_->interfaceGrid(),
+                   HostGridVertex(circulation_.circulator())}};
   }
 
   //! equality
   bool equals(const MMeshIncidentInterfaceVerticesIteratorImp& iter) const {
-    return i_ == iter.i_;
+    return circulation_.equals(iter.circulation_);
   }
 
  private:
+  static bool accept(const Circulator& c) { return c->info().isInterface; }
+
   const typename GridImp::MMeshType* mMesh_;
-  ElementContainer elementContainer_;
-  std::size_t i_;
+  Circulation circulation_;
 };
 
 //! 3D
@@ -91,11 +87,8 @@ class MMeshIncidentInterfaceVerticesIteratorImp<GridImp, 2> {
   //! The type of the requested vertex entity
   typedef typename GridImp::VertexHandle HostGridVertex;
 
-  //! The type of the element output
-  using ElementOutput = std::list<HostGridVertex>;
-
-  //! The type of the element container
-  using ElementContainer = std::vector<HostGridVertex>;
+  //! The type of the vertex container
+  using Vertices = MMeshSmallVector<HostGridVertex, MMeshImpl::starCapacity>;
 
  public:
   enum { codimension = 2 };
@@ -105,13 +98,10 @@ class MMeshIncidentInterfaceVerticesIteratorImp<GridImp, 2> {
   explicit MMeshIncidentInterfaceVerticesIteratorImp(
       const GridImp* igrid, const HostGridVertex& hostEntity)
       : mMesh_(&igrid->getMMesh()), i_(0) {
-    ElementOutput elements;
-    mMesh_->getHostGrid().incident_vertices(hostEntity,
-                                            std::back_inserter(elements));
-
-    typename ElementOutput::iterator fit;
-    for (fit = elements.begin(); fit != elements.end(); fit++)
-      if ((*fit)->info().isInterface) elementContainer_.push_back(*fit);
+    MMeshImpl::incidentVertices(hostEntity, vertices_,
+                                [](const HostGridVertex& vh) {
+                                  return vh->info().isInterface;
+                                });
   }
 
   /** \brief Constructor which creates the end iterator
@@ -120,32 +110,26 @@ class MMeshIncidentInterfaceVerticesIteratorImp<GridImp, 2> {
    */
   explicit MMeshIncidentInterfaceVerticesIteratorImp(
       const GridImp* igrid, const HostGridVertex& hostEntity, bool endDummy)
-      : mMesh_(&igrid->getMMesh()), i_(0) {
-    ElementOutput elements;
-    mMesh_->getHostGrid().incident_vertices(hostEntity,
-                                            std::back_inserter(elements));
-
-    typename ElementOutput::iterator fit;
-    for (fit = elements.begin(); fit != elements.end(); fit++)
-      if ((*fit)->info().isInterface) ++i_;
-  }
+      : mMesh_(&igrid->getMMesh()), i_(0) {}
 
   //! prefix increment
   void increment() { ++i_; }
 
   //! dereferencing
   Entity dereference() const {
-    return Entity{{&mMesh_->interfaceGrid(), elementContainer_[i_]}};
+    return Entity{{&mMesh_->interfaceGrid(), vertices_[i_]}};
   }
 
   //! equality
   bool equals(const MMeshIncidentInterfaceVerticesIteratorImp& iter) const {
-    return i_ == iter.i_;
+    return atEnd_() == iter.atEnd_() && (atEnd_() || i_ == iter.i_);
   }
 
  private:
+  bool atEnd_() const { return i_ >= vertices_.size(); }
+
   const typename GridImp::MMeshType* mMesh_;
-  ElementContainer elementContainer_;
+  Vertices vertices_;
   std::size_t i_;
 };
 
@@ -174,7 +158,10 @@ class MMeshIncidentInterfaceElementsIteratorImp<GridImp, 1> {
 
   //! The type of the element circulator
   using Circulator = typename GridImp::HostGridType::Edge_circulator;
-  using ElementContainer = std::vector<HostGridElement>;
+  using Circulation = MMeshImpl::StarCirculation<Circulator>;
+
+  //! The interface registry answering if a facet is part of the interface
+  using InterfaceRegistry = typename GridImp::MMeshType::InterfaceRegistry;
 
  public:
   enum { codimension = 0 };
@@ -183,13 +170,9 @@ class MMeshIncidentInterfaceElementsIteratorImp<GridImp, 1> {
 
   explicit MMeshIncidentInterfaceElementsIteratorImp(
       const GridImp* igrid, const HostGridVertex& hostEntity)
-      : igrid_(igrid), i_(0) {
-    Circulator circulator = mMesh().getHostGrid().incident_edges(hostEntity);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         ++i, ++circulator)
-      if (mMesh().isInterface(mMesh().entity(*circulator)))
-        elementContainer_.push_back(*circulator);
-  }
+      : igrid_(igrid),
+        circulation_(mMesh().getHostGrid().incident_edges(hostEntity),
+                     accept) {}
 
   /** \brief Constructor which creates the end iterator
    *  \param endDummy      Here only to distinguish it from the other
@@ -197,32 +180,32 @@ class MMeshIncidentInterfaceElementsIteratorImp<GridImp, 1> {
    */
   explicit MMeshIncidentInterfaceElementsIteratorImp(
       const GridImp* igrid, const HostGridVertex& hostEntity, bool endDummy)
-      : igrid_(igrid), i_(0) {
-    Circulator circulator = mMesh().getHostGrid().incident_edges(hostEntity);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         ++i, ++circulator)
-      if (mMesh().isInterface(mMesh().entity(*circulator))) ++i_;
-  }
+      : igrid_(igrid) {}
 
   //! prefix increment
-  void increment() { ++i_; }
+  void increment() { circulation_.increment(accept); }
 
   //! dereferencing
-  Entity dereference() const { return Entity{{igrid_, elementContainer_[i_]}}; }
+  Entity dereference() const {
+    return Entity{{igrid_, HostGridElement(*circulation_.circulator())}};
+  }
 
   //! equality
   bool equals(const MMeshIncidentInterfaceElementsIteratorImp& iter) const {
-    return i_ == iter.i_;
+    return circulation_.equals(iter.circulation_);
   }
 
  private:
+  static bool accept(const Circulator& c) {
+    return InterfaceRegistry::isInterface(*c);
+  }
+
   const typename GridImp::MMeshType& mMesh() const {
     return igrid_->getMMesh();
   }
 
   const GridImp* igrid_;
-  ElementContainer elementContainer_;
-  std::size_t i_;
+  Circulation circulation_;
 };
 
 //! 3D
@@ -235,11 +218,11 @@ class MMeshIncidentInterfaceElementsIteratorImp<GridImp, 2> {
   //! The type of the vertex entity
   typedef typename GridImp::VertexHandle HostGridVertex;
 
-  //! The type of the element output
-  using ElementOutput = std::list<HostGridElement>;
+  //! The type of the star of the vertex
+  using Cells = MMeshImpl::StarCells<typename GridImp::HostGridType>;
 
-  //! The type of the element container
-  using ElementContainer = std::vector<HostGridElement>;
+  //! The interface registry answering if a facet is part of the interface
+  using InterfaceRegistry = typename GridImp::MMeshType::InterfaceRegistry;
 
  public:
   enum { codimension = 0 };
@@ -248,15 +231,9 @@ class MMeshIncidentInterfaceElementsIteratorImp<GridImp, 2> {
 
   explicit MMeshIncidentInterfaceElementsIteratorImp(
       const GridImp* igrid, const HostGridVertex& hostEntity)
-      : igrid_(igrid), i_(0) {
-    ElementOutput elements;
-    mMesh().getHostGrid().finite_incident_facets(hostEntity,
-                                                 std::back_inserter(elements));
-
-    typename ElementOutput::iterator fit;
-    for (fit = elements.begin(); fit != elements.end(); fit++)
-      if (mMesh().isInterface(mMesh().entity(*fit)))
-        elementContainer_.push_back(*fit);
+      : igrid_(igrid), hostEntity_(hostEntity), n_(0), i_(0) {
+    MMeshImpl::incidentCells(hostEntity, cells_);
+    skip_();
   }
 
   /** \brief Constructor which creates the end iterator
@@ -265,35 +242,45 @@ class MMeshIncidentInterfaceElementsIteratorImp<GridImp, 2> {
    */
   explicit MMeshIncidentInterfaceElementsIteratorImp(
       const GridImp* igrid, const HostGridVertex& hostEntity, bool endDummy)
-      : igrid_(igrid), i_(0) {
-    ElementOutput elements;
-    mMesh().getHostGrid().finite_incident_facets(hostEntity,
-                                                 std::back_inserter(elements));
-
-    typename ElementOutput::iterator fit;
-    for (fit = elements.begin(); fit != elements.end(); fit++)
-      if (mMesh().isInterface(mMesh().entity(*fit))) ++i_;
-  }
+      : igrid_(igrid), hostEntity_(hostEntity), n_(0), i_(0) {}
 
   //! prefix increment
-  void increment() { ++i_; }
+  void increment() {
+    ++i_;
+    skip_();
+  }
 
   //! dereferencing
-  Entity dereference() const { return Entity{{igrid_, elementContainer_[i_]}}; }
+  Entity dereference() const {
+    return Entity{{igrid_, HostGridElement(cells_[n_], i_)}};
+  }
 
   //! equality
   bool equals(const MMeshIncidentInterfaceElementsIteratorImp& iter) const {
-    return i_ == iter.i_;
+    return atEnd_() == iter.atEnd_() &&
+           (atEnd_() || (n_ == iter.n_ && i_ == iter.i_));
   }
 
  private:
+  bool atEnd_() const { return n_ >= cells_.size(); }
+
+  void skip_() {
+    MMeshImpl::nextIncidentFacet(
+        mMesh().getHostGrid(), hostEntity_, cells_, n_, i_,
+        [](const auto& c, int i) {
+          return InterfaceRegistry::isInterface(HostGridElement(c, i));
+        });
+  }
+
   const typename GridImp::MMeshType& mMesh() const {
     return igrid_->getMMesh();
   }
 
   const GridImp* igrid_;
-  ElementContainer elementContainer_;
-  std::size_t i_;
+  HostGridVertex hostEntity_;
+  Cells cells_;
+  std::size_t n_;
+  int i_;
 };
 
 //! Forward declaration
@@ -318,9 +305,10 @@ class MMeshEdgeIncidentInterfaceElementsIteratorImp<GridImp, 2> {
 
   //! The type of the facet ciruclator
   using Circulator = typename GridImp::HostGridType::Facet_circulator;
+  using Circulation = MMeshImpl::StarCirculation<Circulator>;
 
-  //! The type of the element container
-  using ElementContainer = std::vector<HostGridElement>;
+  //! The interface registry answering if a facet is part of the interface
+  using InterfaceRegistry = typename GridImp::MMeshType::InterfaceRegistry;
 
  public:
   enum { codimension = 0 };
@@ -329,13 +317,9 @@ class MMeshEdgeIncidentInterfaceElementsIteratorImp<GridImp, 2> {
 
   explicit MMeshEdgeIncidentInterfaceElementsIteratorImp(
       const GridImp* igrid, const HostGridEdge& hostEntity)
-      : igrid_(igrid), i_(0) {
-    Circulator circulator = mMesh().getHostGrid().incident_facets(hostEntity);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         ++i, ++circulator)
-      if (mMesh().isInterface(mMesh().entity(*circulator)))
-        elementContainer_.push_back(*circulator);
-  }
+      : igrid_(igrid),
+        circulation_(mMesh().getHostGrid().incident_facets(hostEntity),
+                     accept) {}
 
   /** \brief Constructor which creates the end iterator
    *  \param endDummy      Here only to distinguish it from the other
@@ -343,32 +327,32 @@ class MMeshEdgeIncidentInterfaceElementsIteratorImp<GridImp, 2> {
    */
   explicit MMeshEdgeIncidentInterfaceElementsIteratorImp(
       const GridImp* igrid, const HostGridEdge& hostEntity, bool endDummy)
-      : igrid_(igrid), i_(0) {
-    Circulator circulator = mMesh().getHostGrid().incident_facets(hostEntity);
-    for (std::size_t i = 0; i < CGAL::circulator_size(circulator);
-         ++i, ++circulator)
-      if (mMesh().isInterface(mMesh().entity(*circulator))) ++i_;
-  }
+      : igrid_(igrid) {}
 
   //! prefix increment
-  void increment() { ++i_; }
+  void increment() { circulation_.increment(accept); }
 
   //! dereferencing
-  Entity dereference() const { return Entity{{igrid_, elementContainer_[i_]}}; }
+  Entity dereference() const {
+    return Entity{{igrid_, HostGridElement(*circulation_.circulator())}};
+  }
 
   //! equality
   bool equals(const MMeshEdgeIncidentInterfaceElementsIteratorImp& iter) const {
-    return i_ == iter.i_;
+    return circulation_.equals(iter.circulation_);
   }
 
  private:
+  static bool accept(const Circulator& c) {
+    return InterfaceRegistry::isInterface(*c);
+  }
+
   const typename GridImp::MMeshType& mMesh() const {
     return igrid_->getMMesh();
   }
 
   const GridImp* igrid_;
-  ElementContainer elementContainer_;
-  std::size_t i_;
+  Circulation circulation_;
 };
 
 }  // namespace Dune
@@ -9,6 +9,7 @@
 
 // Dune includes
 #include <dune/grid/common/indexidset.hh>
+#include <dune/mmesh/grid/memoryusage.hh>
 #include <dune/mmesh/grid/multiid.hh>
 
 namespace Dune {
@@ -341,6 +342,16 @@ class MMeshInterfaceGridLeafIndexSet
 
   const VertexIndexMap& vertexIndexMap() const { return vertexIndices_; }
 
+  //! Return the (estimated) number of bytes used by the index maps
+  std::size_t memoryUsage() const {
+    std::size_t bytes = MMeshImpl::memoryUsage(indexMap_) +
+                        MMeshImpl::memoryUsage(edgeIndexMap_) +
+                        MMeshImpl::memoryUsage(vertexIndices_);
+    for (const auto& entry : indexMap_)
+      bytes += MMeshImpl::memoryUsage(entry.second);
+    return bytes;
+  }
+
  private:
   GridImp* grid_;
   std::array<std::size_t, dimension + 1> sizeOfCodim_;
@@ -436,7 +447,7 @@ class MMeshInterfaceGridGlobalIdSet
       // ( codim == 1 )
       {
         if (e.impl().id() != dummyId)
-          return e.impl().id().vt()[i];
+          return e.impl().id()[i];
         else
           return IdType(std::size_t(-3 + i));
       }
@@ -14,6 +14,9 @@ namespace Dune {
 
 /** \brief Iterator over all entities of a given codimension and level of a grid
  * (2D). \ingroup MMesh
+ *
+ * The iterators traverse the interface registry of the bulk grid, i.e. their
+ * cost only depends on the size of the interface.
  */
 
 template <int codim, PartitionIteratorType pitype, class GridImp,
@@ -24,32 +27,29 @@ template <int codim, PartitionIteratorType pitype, class GridImp>
 using MMeshInterfaceGridLeafIterator =
     MMeshInterfaceGridLeafIteratorImp<codim, pitype, GridImp>;
 
-/** \brief MMeshInterfaceGridLeafIteratorImp for 2D
+/** \brief MMeshInterfaceGridLeafIteratorImp for interface elements
  */
 
 template <PartitionIteratorType pitype, class GridImp>
-class MMeshInterfaceGridLeafIteratorImp<
-    0, pitype, GridImp, std::enable_if_t<GridImp::dimensionworld == 2>> {
+class MMeshInterfaceGridLeafIteratorImp<0, pitype, GridImp> {
  private:
-  //! The type of the underlying entity iterator
-  using HostGridLeafIterator =
-      typename GridImp::HostGridType::Finite_faces_iterator;
   //! The type of the underlying interface host entity
   using HostGridFacet = typename GridImp::MMeshType::FacetHandle;
+  //! The type of the interface registry
+  using Registry = typename GridImp::MMeshType::InterfaceRegistry;
 
  public:
   enum { codimension = 0 };
 
   typedef typename GridImp::template Codim<0>::Entity Entity;
 
-  explicit MMeshInterfaceGridLeafIteratorImp() : mMesh_(nullptr) {}
+  explicit MMeshInterfaceGridLeafIteratorImp()
+      : mMesh_(nullptr), facets_(nullptr), i_(0) {}
 
   explicit MMeshInterfaceGridLeafIteratorImp(const GridImp* mMesh)
       : mMesh_(mMesh),
-        hostLeafIterator_(pitype == Interior_Partition
-                              ? mMesh->partitionHelper().leafInteriorBegin()
-                              : mMesh->getHostGrid().finite_faces_begin()),
-        face_(0) {
+        facets_(&mMesh->getMMesh().interfaceRegistry().facets()),
+        i_(0) {
     if (proceed()) increment();
   }
 
@@ -60,63 +60,47 @@ class MMeshInterfaceGridLeafIteratorImp<
   explicit MMeshInterfaceGridLeafIteratorImp(const GridImp* mMesh,
                                              bool endDummy)
       : mMesh_(mMesh),
-        hostLeafIterator_(pitype == Interior_Partition
-                              ? mMesh->partitionHelper().leafInteriorEnd()
-                              : mMesh->getHostGrid().finite_faces_end()),
-        face_(0) {}
+        facets_(&mMesh->getMMesh().interfaceRegistry().facets()),
+        i_(facets_->size()) {}
 
   //! prefix increment
   void increment() {
     do {
-      face_++;
-      if (face_ == 3) {
-        ++hostLeafIterator_;
-        face_ = 0;
-      }
+      i_++;
     } while (proceed());
   }
 
   //! dereferencing
-  Entity dereference() const {
-    return Entity{{mMesh_, HostGridFacet(hostLeafIterator_, face_)}};
-  }
+  Entity dereference() const { return Entity{{mMesh_, (*facets_)[i_]}}; }
 
   //! equality
   bool equals(const MMeshInterfaceGridLeafIteratorImp& i) const {
-    return hostLeafIterator_ == i.hostLeafIterator_ && face_ == i.face_;
+    return i_ == i.i_;
   }
 
  private:
   //! return if this iterator should further be incremented
   bool proceed() {
-    const auto endIterator = (pitype == Interior_Partition
-                                  ? mMesh_->partitionHelper().leafInteriorEnd()
-                                  : mMesh_->getHostGrid().finite_faces_end());
-    if (hostLeafIterator_ == endIterator) return false;
-
-    HostGridFacet facet(hostLeafIterator_, face_);
-    if (!mMesh_->isInterface(facet)) return true;
-
-    const auto mirrored = hostLeafIterator_->neighbor(face_);
-    if (hostLeafIterator_->info().insertionIndex >
-        mirrored->info().insertionIndex)
-      return true;
-
+    if (i_ >= facets_->size()) return false;
+    if (!Registry::valid((*facets_)[i_])) return true;
     return !mMesh_->partitionHelper().contains(pitype, dereference());
   }
 
   const GridImp* mMesh_;
 
-  HostGridLeafIterator hostLeafIterator_;
-  int face_;
+  const std::vector<HostGridFacet>* facets_;
+  std::size_t i_;
 };
 
-template <PartitionIteratorType pitype, class GridImp>
+/** \brief MMeshInterfaceGridLeafIteratorImp for interface vertices
+ */
+
+template <int codim, PartitionIteratorType pitype, class GridImp>
 class MMeshInterfaceGridLeafIteratorImp<
-    1, pitype, GridImp, std::enable_if_t<GridImp::dimensionworld == 2>> {
+    codim, pitype, GridImp, std::enable_if_t<codim == GridImp::dimension>> {
  private:
   //! The type of the underlying entities
-  typedef typename GridImp::HostGridType::Vertex_iterator HostGridLeafIterator;
+  using HostGridVertex = typename GridImp::MMeshType::VertexHandle;
 
  public:
   enum { codimension = GridImp::dimension };
@@ -125,9 +109,9 @@ class MMeshInterfaceGridLeafIteratorImp<
 
   explicit MMeshInterfaceGridLeafIteratorImp(const GridImp* mMesh)
       : mMesh_(mMesh),
-        hostLeafIterator_(mMesh->getHostGrid().finite_vertices_begin()),
-        hostLeafIteratorEnd_(mMesh->getHostGrid().finite_vertices_end()) {
-    while (proceed()) ++hostLeafIterator_;
+        vertices_(&mMesh->getMMesh().interfaceRegistry().vertices()),
+        i_(0) {
+    while (proceed()) ++i_;
   }
 
   /** \brief Constructor which create the end iterator
@@ -137,133 +121,49 @@ class MMeshInterfaceGridLeafIteratorImp<
   explicit MMeshInterfaceGridLeafIteratorImp(const GridImp* mMesh,
                                              bool endDummy)
       : mMesh_(mMesh),
-        hostLeafIterator_(mMesh->getHostGrid().finite_vertices_end()),
-        hostLeafIteratorEnd_(mMesh->getHostGrid().finite_vertices_end()) {}
+        vertices_(&mMesh->getMMesh().interfaceRegistry().vertices()),
+        i_(vertices_->size()) {}
 
   //! prefix increment
   void increment() {
-    ++hostLeafIterator_;
+    ++i_;
 
-    while (proceed()) ++hostLeafIterator_;
+    while (proceed()) ++i_;
   }
 
   //! dereferencing
-  Entity dereference() const { return Entity{{mMesh_, hostLeafIterator_}}; }
+  Entity dereference() const { return Entity{{mMesh_, (*vertices_)[i_]}}; }
 
   //! equality
   bool equals(const MMeshInterfaceGridLeafIteratorImp& i) const {
-    return hostLeafIterator_ == i.hostLeafIterator_;
+    return i_ == i.i_;
   }
 
  private:
   //! return if this iterator should further be incremented
   bool proceed() {
-    if (hostLeafIterator_ == hostLeafIteratorEnd_) return false;
-    if (!hostLeafIterator_->info().isInterface) return true;
+    if (i_ >= vertices_->size()) return false;
     return !mMesh_->partitionHelper().contains(pitype, dereference());
   }
 
   const GridImp* mMesh_;
 
-  HostGridLeafIterator hostLeafIterator_;
-  HostGridLeafIterator hostLeafIteratorEnd_;
+  const std::vector<HostGridVertex>* vertices_;
+  std::size_t i_;
 };
 
-/** \brief MMeshInterfaceGridLeafIteratorImp for 3D
+/** \brief MMeshInterfaceGridLeafIteratorImp for interface edges in 3D
  *  \ingroup MMesh
  */
 
-template <PartitionIteratorType pitype, class GridImp>
-class MMeshInterfaceGridLeafIteratorImp<
-    0, pitype, GridImp, std::enable_if_t<GridImp::dimensionworld == 3>> {
- private:
-  //! The type of the underlying entity iterator
-  using HostGridLeafIterator =
-      typename GridImp::HostGridType::Finite_cells_iterator;
-  //! The type of the underlying interface host entity
-  using HostGridFacet = typename GridImp::MMeshType::FacetHandle;
-
- public:
-  enum { codimension = 0 };
-
-  typedef typename GridImp::template Codim<0>::Entity Entity;
-
-  explicit MMeshInterfaceGridLeafIteratorImp() : mMesh_(nullptr) {}
-
-  explicit MMeshInterfaceGridLeafIteratorImp(const GridImp* mMesh)
-      : mMesh_(mMesh),
-        hostLeafIterator_(pitype == Interior_Partition
-                              ? mMesh->partitionHelper().leafInteriorBegin()
-                              : mMesh->getHostGrid().finite_cells_begin()),
-        face_(0) {
-    if (proceed()) increment();
-  }
-
-  /** \brief Constructor which creates the end iterator
-   *  \param mMesh    Pointer to grid instance
-   *  \param endDummy Here only to distinguish it from the other constructor
-   */
-  explicit MMeshInterfaceGridLeafIteratorImp(const GridImp* mMesh,
-                                             bool endDummy)
-      : mMesh_(mMesh),
-        hostLeafIterator_(pitype == Interior_Partition
-                              ? mMesh->partitionHelper().leafInteriorEnd()
-                              : mMesh->getHostGrid().finite_cells_end()),
-        face_(0) {}
-
-  //! prefix increment
-  void increment() {
-    do {
-      face_++;
-      if (face_ == 4) {
-        ++hostLeafIterator_;
-        face_ = 0;
-      }
-    } while (proceed());
-  }
-
-  //! dereferencing
-  Entity dereference() const {
-    return Entity{{mMesh_, HostGridFacet(hostLeafIterator_, face_)}};
-  }
-
-  //! equality
-  bool equals(const MMeshInterfaceGridLeafIteratorImp& i) const {
-    return hostLeafIterator_ == i.hostLeafIterator_ && face_ == i.face_;
-  }
-
- private:
-  //! return if this iterator should further be incremented
-  bool proceed() {
-    const auto endIterator = (pitype == Interior_Partition
-                                  ? mMesh_->partitionHelper().leafInteriorEnd()
-                                  : mMesh_->getHostGrid().finite_cells_end());
-    if (hostLeafIterator_ == endIterator) return false;
-
-    HostGridFacet facet(hostLeafIterator_, face_);
-    if (!mMesh_->isInterface(facet)) return true;
-
-    const auto mirrored = hostLeafIterator_->neighbor(face_);
-    if (hostLeafIterator_->info().insertionIndex >
-        mirrored->info().insertionIndex)
-      return true;
-
-    return !mMesh_->partitionHelper().contains(pitype, dereference());
-  }
-
-  const GridImp* mMesh_;
-
-  HostGridLeafIterator hostLeafIterator_;
-  int face_;
-};
-
 template <PartitionIteratorType pitype, class GridImp>
 class MMeshInterfaceGridLeafIteratorImp<
     1, pitype, GridImp, std::enable_if_t<GridImp::dimensionworld == 3>> {
  private:
   //! The type of the underlying entities
-  using HostGridLeafIterator =
-      typename GridImp::HostGridType::Finite_edges_iterator;
+  using HostGridEdge = typename GridImp::MMeshType::EdgeHandle;
+  //! The type of the interface registry
+  using Registry = typename GridImp::MMeshType::InterfaceRegistry;
 
  public:
   enum { codimension = 1 };
@@ -272,9 +172,9 @@ class MMeshInterfaceGridLeafIteratorImp<
 
   explicit MMeshInterfaceGridLeafIteratorImp(const GridImp* mMesh)
       : mMesh_(mMesh),
-        hostLeafIterator_(mMesh->getHostGrid().finite_edges_begin()),
-        hostLeafIteratorEnd_(mMesh->getHostGrid().finite_edges_end()) {
-    while (proceed()) ++hostLeafIterator_;
+        edges_(&mMesh->getMMesh().interfaceRegistry().edges()),
+        i_(0) {
+    while (proceed()) ++i_;
   }
 
   /** \brief Constructor which creates the end iterator
@@ -284,94 +184,36 @@ class MMeshInterfaceGridLeafIteratorImp<
   explicit MMeshInterfaceGridLeafIteratorImp(const GridImp* mMesh,
                                              bool endDummy)
       : mMesh_(mMesh),
-        hostLeafIterator_(mMesh->getHostGrid().finite_edges_end()),
-        hostLeafIteratorEnd_(mMesh->getHostGrid().finite_edges_end()) {}
-
-  //! prefix increment
-  void increment() {
-    ++hostLeafIterator_;
-
-    while (proceed()) ++hostLeafIterator_;
-  }
-
-  //! dereferencing
-  Entity dereference() const { return Entity{{mMesh_, *hostLeafIterator_}}; }
-
-  //! equality
-  bool equals(const MMeshInterfaceGridLeafIteratorImp& i) const {
-    return hostLeafIterator_ == i.hostLeafIterator_;
-  }
-
- private:
-  //! return if this iterator should further be incremented
-  bool proceed() {
-    if (hostLeafIterator_ == hostLeafIteratorEnd_) return false;
-    if (!mMesh_->isInterface(*hostLeafIterator_)) return true;
-    return !mMesh_->partitionHelper().contains(pitype, dereference());
-  }
-
-  const GridImp* mMesh_;
-
-  HostGridLeafIterator hostLeafIterator_;
-  HostGridLeafIterator hostLeafIteratorEnd_;
-};
-
-template <PartitionIteratorType pitype, class GridImp>
-class MMeshInterfaceGridLeafIteratorImp<
-    2, pitype, GridImp, std::enable_if_t<GridImp::dimensionworld == 3>> {
- private:
-  //! The type of the underlying entities
-  typedef typename GridImp::HostGridType::Vertex_iterator HostGridLeafIterator;
-
- public:
-  enum { codimension = GridImp::dimension };
-
-  typedef typename GridImp::template Codim<codimension>::Entity Entity;
-
-  explicit MMeshInterfaceGridLeafIteratorImp(const GridImp* mMesh)
-      : mMesh_(mMesh),
-        hostLeafIterator_(mMesh->getHostGrid().finite_vertices_begin()),
-        hostLeafIteratorEnd_(mMesh->getHostGrid().finite_vertices_end()) {
-    while (proceed()) ++hostLeafIterator_;
-  }
-
-  /** \brief Constructor which create the end iterator
-   *  \param endDummy      Here only to distinguish it from the other
-   * constructor \param mMesh  pointer to grid instance
-   */
-  explicit MMeshInterfaceGridLeafIteratorImp(const GridImp* mMesh,
-                                             bool endDummy)
-      : mMesh_(mMesh),
-        hostLeafIterator_(mMesh->getHostGrid().finite_vertices_end()),
-        hostLeafIteratorEnd_(mMesh->getHostGrid().finite_vertices_end()) {}
+        edges_(&mMesh->getMMesh().interfaceRegistry().edges()),
+        i_(edges_->size()) {}
 
   //! prefix increment
   void increment() {
-    ++hostLeafIterator_;
+    ++i_;
 
-    while (proceed()) ++hostLeafIterator_;
+    while (proceed()) ++i_;
   }
 
   //! dereferencing
-  Entity dereference() const { return Entity{{mMesh_, hostLeafIterator_}}; }
+  Entity dereference() const { return Entity{{mMesh_, (*edges_)[i_]}}; }
 
   //! equality
   bool equals(const MMeshInterfaceGridLeafIteratorImp& i) const {
-    return hostLeafIterator_ == i.hostLeafIterator_;
+    return i_ == i.i_;
   }
 
  private:
   //! return if this iterator should further be incremented
   bool proceed() {
-    if (hostLeafIterator_ == hostLeafIteratorEnd_) return false;
-    if (!hostLeafIterator_->info().isInterface) return true;
+    if (i_ >= edges_->size()) return false;
+    if (!Registry::valid((*edges_)[i_])) return true;
     return !mMesh_->partitionHelper().contains(pitype, dereference());
   }
 
   const GridImp* mMesh_;
 
-  HostGridLeafIterator hostLeafIterator_;
-  HostGridLeafIterator hostLeafIteratorEnd_;
+  const std::vector<HostGridEdge>* edges_;
+  std::size_t i_;
 };
 
 }  // namespace Dune
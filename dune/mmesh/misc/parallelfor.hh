@@ -0,0 +1,33 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_MMESH_MISC_PARALLELFOR_HH
+#define DUNE_MMESH_MISC_PARALLELFOR_HH
+
+/** \file
+ * \brief Shared memory parallel loops
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Dune {
+namespace MMeshImpl {
+
+/** \brief Call f(i) for i = 0,...,n-1 in parallel
+ *
+ *  The loop is distributed with OpenMP if enabled, otherwise it runs
+ *  serially. The calls must be independent of each other.
+ */
+template <class F>
+void parallelFor(std::size_t n, const F& f) {
+  const std::int64_t size = n;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (std::int64_t i = 0; i < size; ++i) f(std::size_t(i));
+}
+
+}  // end namespace MMeshImpl
+}  // end namespace Dune
+
+#endif
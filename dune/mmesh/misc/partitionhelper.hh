@@ -4,6 +4,7 @@
 #define DUNE_MMESH_MISC_PARTITIONHELPER_HH
 
 #include <dune/grid/common/partitionset.hh>
+#include <dune/mmesh/grid/memoryusage.hh>
 #include <dune/mmesh/grid/rangegenerators.hh>
 
 namespace Dune {
@@ -86,15 +87,11 @@ struct PartitionHelper {
 
   //! Get connectivity (list of ranks)
   template <class Entity>
-  ConnectivityType connectivity(const Entity& e) const {
-    if constexpr (Entity::dimension == dim)
-      return e.impl().hostEntity()->info().connectivity;
-    else
-      try {
-        return interfaceConnectivity_.at(e.impl().id());
-      } catch (std::out_of_range&) {
-        return ConnectivityType();
-      }
+  const ConnectivityType& connectivity(const Entity& e) const {
+    static const ConnectivityType empty;
+    const auto& map = connectivityMap<Entity>();
+    auto entry = map.find(e.impl().id());
+    return (entry != map.end()) ? entry->second : empty;
   }
 
   //! Get rank of an entity
@@ -106,6 +103,19 @@ struct PartitionHelper {
       return grid().asIntersection(e).inside().impl().hostEntity()->info().rank;
   }
 
+  //! Return the (estimated) number of bytes used by the side tables
+  std::size_t memoryUsage() const {
+    using MMeshImpl::memoryUsage;
+    std::size_t bytes = memoryUsage(links_);
+    for (const auto& map : partition_) bytes += memoryUsage(map);
+    for (const auto& map : interfacePartition_) bytes += memoryUsage(map);
+    for (const auto* map : {&connectivity_, &interfaceConnectivity_}) {
+      bytes += memoryUsage(*map);
+      for (const auto& entry : *map) bytes += memoryUsage(entry.second);
+    }
+    return bytes;
+  }
+
   const LeafIterator& leafInteriorBegin() const { return leafBegin_; }
 
   const LeafIterator& leafInteriorEnd() const { return leafEnd_; }
@@ -148,13 +158,28 @@ struct PartitionHelper {
       interfacePartition_[Entity::codimension][e.impl().id()] = partition;
   }
 
-  //! Add connectivity
+  //! Return the connectivity map of the given entity type. Only border
+  //! entities have an entry.
   template <class Entity>
-  void addConnectivity(const Entity& e, int rank) {
+  auto& connectivityMap() {
+    if constexpr (Entity::dimension == dim)
+      return connectivity_;
+    else
+      return interfaceConnectivity_;
+  }
+
+  template <class Entity>
+  const auto& connectivityMap() const {
     if constexpr (Entity::dimension == dim)
-      e.impl().hostEntity()->info().connectivity.insert(rank);
+      return connectivity_;
     else
-      interfaceConnectivity_[e.impl().id()].insert(rank);
+      return interfaceConnectivity_;
+  }
+
+  //! Add connectivity
+  template <class Entity>
+  void addConnectivity(const Entity& e, int rank) {
+    connectivityMap<Entity>()[e.impl().id()].insert(rank);
 
     if (partition(e) == 0)
       if (std::find(links_.begin(), links_.end(), rank) == links_.end())
@@ -164,10 +189,7 @@ struct PartitionHelper {
   //! Clear connectivity
   template <class Entity>
   void clearConnectivity(const Entity& e) {
-    if constexpr (Entity::dimension == dim)
-      e.impl().hostEntity()->info().connectivity.clear();
-    else
-      interfaceConnectivity_[e.impl().id()].clear();
+    connectivityMap<Entity>().erase(e.impl().id());
   }
 
   //! Set rank for every entity. We use a naiv partitioning using the entity
@@ -204,6 +226,7 @@ struct PartitionHelper {
     links_.clear();
 
     for (int i = 0; i <= dim; ++i) partition_[i].clear();
+    connectivity_.clear();
 
     // Set interior elements
     forEntityDim<dim>([this](const auto& fc) {
@@ -212,8 +235,6 @@ struct PartitionHelper {
         setPartition(e, 0);  // interior
       else
         setPartition(e, -1);  // none
-
-      clearConnectivity(e);
     });
 
     // Set ghosts
@@ -503,6 +524,7 @@ struct PartitionHelper {
   std::array<double, 2> xbounds_;
   std::array<std::unordered_map<IdType, int>, dim - 1> partition_;
   std::array<std::unordered_map<IdType, int>, dim> interfacePartition_;
+  std::unordered_map<IdType, ConnectivityType> connectivity_;
   std::unordered_map<IdType, ConnectivityType> interfaceConnectivity_;
   LeafIterator leafBegin_, leafEnd_;
   LinksType links_;
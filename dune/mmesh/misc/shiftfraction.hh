@@ -0,0 +1,143 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_MMESH_MISC_SHIFTFRACTION_HH
+#define DUNE_MMESH_MISC_SHIFTFRACTION_HH
+
+/** \file
+ * \brief Feasible fractions of vertex shifts
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include <dune/common/fvector.hh>
+#include <dune/common/math.hh>
+
+namespace Dune {
+namespace MMeshImpl {
+
+/** \brief Return the smallest root of c[0] + c[1] t + ... in (0, 1]
+ *
+ *  The polynomial has degree at most three. Leading coefficients that are
+ *  small compared to the others are dropped and the real roots are computed
+ *  in closed form. Returns infinity if there is no root in (0, 1].
+ */
+template <class T, std::size_t n>
+T smallestRootInUnitInterval(const std::array<T, n>& c) {
+  static_assert(n <= 4, "Only polynomials up to degree three are supported");
+  static constexpr T eps = 1e-12;
+  const T infinity = std::numeric_limits<T>::infinity();
+
+  T scale = 0.0;
+  for (const T ci : c) scale = std::max(scale, std::abs(ci));
+  if (scale == 0.0) return infinity;
+
+  int degree = n - 1;
+  while (degree > 0 && std::abs(c[degree]) <= eps * scale) --degree;
+
+  std::array<T, 3> roots;
+  int numRoots = 0;
+
+  if (degree == 1)
+    roots[numRoots++] = -c[0] / c[1];
+
+  else if (degree == 2) {
+    const T disc = c[1] * c[1] - 4.0 * c[2] * c[0];
+    if (disc >= 0.0) {
+      // avoid cancellation, see Numerical Recipes, Section 5.6
+      const T q = -0.5 * (c[1] + std::copysign(std::sqrt(disc), c[1]));
+      roots[numRoots++] = q / c[2];
+      if (q != 0.0) roots[numRoots++] = c[0] / q;
+    }
+  }
+
+  else if (degree == 3) {
+    // reduce t^3 + a t^2 + b t + d to y^3 + p y + q with t = y - a / 3
+    const T a = c[2] / c[3], b = c[1] / c[3], d = c[0] / c[3];
+    const T p = b - a * a / 3.0;
+    const T q = 2.0 * a * a * a / 27.0 - a * b / 3.0 + d;
+    const T disc = 0.25 * q * q + p * p * p / 27.0;
+
+    if (disc > 0.0) {
+      const T sqrtDisc = std::sqrt(disc);
+      roots[numRoots++] =
+          std::cbrt(-0.5 * q + sqrtDisc) + std::cbrt(-0.5 * q - sqrtDisc);
+    } else if (p == 0.0)
+      roots[numRoots++] = 0.0;
+    else {
+      // three real roots, trigonometric solution
+      const T r = 2.0 * std::sqrt(-p / 3.0);
+      const T phi = std::acos(
+          std::clamp(3.0 * q / (p * r), T(-1.0), T(1.0)));
+      const T pi = StandardMathematicalConstants<T>::pi();
+      for (int k = 0; k < 3; ++k)
+        roots[numRoots++] = r * std::cos((phi - 2.0 * pi * k) / 3.0);
+    }
+
+    for (int k = 0; k < numRoots; ++k) roots[k] -= a / 3.0;
+  }
+
+  T smallest = infinity;
+  for (int k = 0; k < numRoots; ++k) {
+    // polish the root with a Newton step
+    T t = roots[k];
+    T value = 0.0, derivative = 0.0;
+    for (int i = degree; i >= 0; --i) {
+      derivative = derivative * t + value;
+      value = value * t + c[i];
+    }
+    if (derivative != 0.0) t -= value / derivative;
+
+    if (t > 0.0 && t <= 1.0) smallest = std::min(smallest, t);
+  }
+  return smallest;
+}
+
+/** \brief Return the largest fraction of the shifts that keeps a simplex
+ *         positively oriented
+ *
+ *  The signed volume of the simplex with corners x[k] + t s[k] is a
+ *  polynomial of degree dim in t. Returns its smallest root in (0, 1], 1 if
+ *  there is none and 0 if the simplex is not positively oriented at t = 0.
+ */
+template <class T, int dim>
+T maxShiftFraction(const std::array<FieldVector<T, dim>, dim + 1>& x,
+                   const std::array<FieldVector<T, dim>, dim + 1>& s) {
+  std::array<FieldVector<T, dim>, dim> e, de;
+  for (int i = 0; i < dim; ++i) {
+    e[i] = x[i + 1] - x[0];
+    de[i] = s[i + 1] - s[0];
+  }
+
+  std::array<T, dim + 1> c;
+  if constexpr (dim == 2) {
+    auto det = [](const auto& u, const auto& v) {
+      return u[0] * v[1] - u[1] * v[0];
+    };
+    c[0] = det(e[0], e[1]);
+    c[1] = det(de[0], e[1]) + det(e[0], de[1]);
+    c[2] = det(de[0], de[1]);
+  } else {
+    auto det = [](const auto& u, const auto& v, const auto& w) {
+      return u[0] * (v[1] * w[2] - v[2] * w[1]) -
+             u[1] * (v[0] * w[2] - v[2] * w[0]) +
+             u[2] * (v[0] * w[1] - v[1] * w[0]);
+    };
+    c[0] = det(e[0], e[1], e[2]);
+    c[1] = det(de[0], e[1], e[2]) + det(e[0], de[1], e[2]) +
+           det(e[0], e[1], de[2]);
+    c[2] = det(e[0], de[1], de[2]) + det(de[0], e[1], de[2]) +
+           det(de[0], de[1], e[2]);
+    c[3] = det(de[0], de[1], de[2]);
+  }
+
+  if (c[0] <= 0.0) return 0.0;
+  return std::min(T(1.0), smallestRootInUnitInterval(c));
+}
+
+}  // end namespace MMeshImpl
+}  // end namespace Dune
+
+#endif
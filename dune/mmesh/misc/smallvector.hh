@@ -0,0 +1,78 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_MMESH_MISC_SMALLVECTOR_HH
+#define DUNE_MMESH_MISC_SMALLVECTOR_HH
+
+/** \file
+ * \brief The MMeshSmallVector class
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace Dune {
+
+/** \brief Vector with inline storage for the first N entries
+ *  \ingroup MMesh
+ *
+ *  Entries are stored in an inline array as long as there are at most N of
+ *  them. Only if the vector grows beyond N entries they are moved to the heap.
+ *  This is used for small local containers, e.g. the star of a vertex.
+ */
+template <class T, std::size_t N>
+class MMeshSmallVector {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  //! Append an entry
+  void push_back(const T& value) {
+    if (size_ < N)
+      inline_[size_] = value;
+    else {
+      if (size_ == N) heap_.assign(inline_.begin(), inline_.end());
+      heap_.push_back(value);
+    }
+    ++size_;
+  }
+
+  //! Remove all entries, the heap storage is kept
+  void clear() {
+    size_ = 0;
+    heap_.clear();
+  }
+
+  //! Return if value is contained
+  bool contains(const T& value) const {
+    return std::find(begin(), end(), value) != end();
+  }
+
+  size_type size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  T& operator[](size_type i) { return data()[i]; }
+  const T& operator[](size_type i) const { return data()[i]; }
+
+  T* data() { return onHeap_() ? heap_.data() : inline_.data(); }
+  const T* data() const { return onHeap_() ? heap_.data() : inline_.data(); }
+
+  iterator begin() { return data(); }
+  iterator end() { return data() + size_; }
+  const_iterator begin() const { return data(); }
+  const_iterator end() const { return data() + size_; }
+
+ private:
+  bool onHeap_() const { return size_ > N; }
+
+  std::array<T, N> inline_;
+  std::vector<T> heap_;
+  size_type size_ = 0;
+};
+
+}  // namespace Dune
+
+#endif
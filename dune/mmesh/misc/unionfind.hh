@@ -0,0 +1,65 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_MMESH_MISC_UNIONFIND_HH
+#define DUNE_MMESH_MISC_UNIONFIND_HH
+
+/** \file
+ * \brief The MMeshUnionFind class
+ */
+
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace Dune {
+
+/** \brief Disjoint sets of consecutive labels
+ *  \ingroup MMesh
+ *
+ *  The representative of a set is its smallest label, such that labels
+ *  that existed before the sets were united keep their number. The paths
+ *  are halved on every find.
+ */
+class MMeshUnionFind {
+ public:
+  //! Reset to n singleton sets with the labels 0,...,n-1
+  void reset(std::size_t n) {
+    parent_.resize(n);
+    std::iota(parent_.begin(), parent_.end(), 0);
+  }
+
+  //! Add a singleton set and return its label
+  std::size_t add() {
+    parent_.push_back(parent_.size());
+    return parent_.size() - 1;
+  }
+
+  //! Return the number of labels
+  std::size_t size() const { return parent_.size(); }
+
+  //! Return the representative of the set containing label a
+  std::size_t find(std::size_t a) {
+    while (parent_[a] != a) {
+      parent_[a] = parent_[parent_[a]];
+      a = parent_[a];
+    }
+    return a;
+  }
+
+  //! Unite the sets containing the labels a and b
+  void unite(std::size_t a, std::size_t b) {
+    a = find(a);
+    b = find(b);
+    if (a < b)
+      parent_[b] = a;
+    else
+      parent_[a] = b;
+  }
+
+ private:
+  std::vector<std::size_t> parent_;
+};
+
+}  // end namespace Dune
+
+#endif
@@ -0,0 +1,263 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+/*!
+ * \file
+ * \ingroup MMesh Remeshing
+ * \brief   Bounding volume hierarchy for distance queries.
+ */
+
+#ifndef DUNE_MMESH_REMESHING_BOUNDINGVOLUMEHIERARCHY_HH
+#define DUNE_MMESH_REMESHING_BOUNDINGVOLUMEHIERARCHY_HH
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <dune/common/fvector.hh>
+
+namespace Dune {
+
+namespace MMeshImpl {
+
+//! Return the squared distance of x to the segment (a, b)
+template <class GlobalCoordinate>
+auto squaredDistanceToSegment(const GlobalCoordinate& x,
+                              const GlobalCoordinate& a,
+                              const GlobalCoordinate& b) {
+  const GlobalCoordinate ab = b - a;
+  const auto length2 = ab.two_norm2();
+
+  auto t = (length2 > 0.0) ? ((x - a) * ab) / length2 : 0.0;
+  t = std::clamp(t, decltype(t)(0.0), decltype(t)(1.0));
+
+  GlobalCoordinate d = a;
+  d.axpy(t, ab);
+  d -= x;
+  return d.two_norm2();
+}
+
+/*!
+ * \brief Return the squared distance of x to the triangle (a, b, c)
+ *
+ * The closest point is determined by the Voronoi region of x, see
+ * C. Ericson, Real-Time Collision Detection, Section 5.1.5.
+ */
+template <class GlobalCoordinate>
+auto squaredDistanceToTriangle(const GlobalCoordinate& x,
+                               const GlobalCoordinate& a,
+                               const GlobalCoordinate& b,
+                               const GlobalCoordinate& c) {
+  const GlobalCoordinate ab = b - a;
+  const GlobalCoordinate ac = c - a;
+
+  // vertex region a
+  const GlobalCoordinate ax = x - a;
+  const auto d1 = ab * ax;
+  const auto d2 = ac * ax;
+  if (d1 <= 0.0 && d2 <= 0.0) return ax.two_norm2();
+
+  // vertex region b
+  const GlobalCoordinate bx = x - b;
+  const auto d3 = ab * bx;
+  const auto d4 = ac * bx;
+  if (d3 >= 0.0 && d4 <= d3) return bx.two_norm2();
+
+  // edge region ab
+  const auto vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+    return squaredDistanceToSegment(x, a, b);
+
+  // vertex region c
+  const GlobalCoordinate cx = x - c;
+  const auto d5 = ab * cx;
+  const auto d6 = ac * cx;
+  if (d6 >= 0.0 && d5 <= d6) return cx.two_norm2();
+
+  // edge region ac
+  const auto vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+    return squaredDistanceToSegment(x, a, c);
+
+  // edge region bc
+  const auto va = d3 * d6 - d5 * d4;
+  if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+    return squaredDistanceToSegment(x, b, c);
+
+  // face region
+  const auto denom = 1.0 / (va + vb + vc);
+  GlobalCoordinate p = a;
+  p.axpy(vb * denom, ab);
+  p.axpy(vc * denom, ac);
+  p -= x;
+  return p.two_norm2();
+}
+
+}  // end namespace MMeshImpl
+
+/*!
+ * \ingroup MMesh Remeshing
+ * \brief   Bounding volume hierarchy of segments (2d) or triangles (3d)
+ *
+ * The primitives are split at the median of their centers along the longest
+ * axis until at most leafSize primitives remain. Distance queries traverse
+ * the nearer child first and skip boxes farther away than the current
+ * minimum. Queries are const and can be run concurrently.
+ */
+template <int dim, class ctype = double>
+class MMeshBoundingVolumeHierarchy {
+ public:
+  using GlobalCoordinate = FieldVector<ctype, dim>;
+
+  //! A segment in 2d or a triangle in 3d
+  using Primitive = std::array<GlobalCoordinate, dim>;
+
+  //! Maximal number of primitives in a leaf
+  static constexpr std::size_t leafSize = 4;
+
+  //! Build the hierarchy of the given primitives
+  void build(std::vector<Primitive> primitives) {
+    primitives_ = std::move(primitives);
+    nodes_.clear();
+    if (primitives_.empty()) return;
+
+    nodes_.reserve(2 * (primitives_.size() / leafSize + 1));
+    nodes_.emplace_back();
+    build_(0, 0, primitives_.size());
+  }
+
+  //! Return if there are no primitives
+  bool empty() const { return primitives_.empty(); }
+
+  //! Return the number of primitives
+  std::size_t size() const { return primitives_.size(); }
+
+  //! Return the distance of x to the closest primitive
+  ctype distance(const GlobalCoordinate& x) const {
+    return std::sqrt(squaredDistance(x));
+  }
+
+  //! Return the squared distance of x to the closest primitive
+  ctype squaredDistance(const GlobalCoordinate& x) const {
+    ctype best = std::numeric_limits<ctype>::max();
+    if (nodes_.empty()) return best;
+
+    // the tree is balanced, hence, its depth is bounded by log2(size) + 1
+    std::array<std::uint32_t, 64> stack;
+    std::size_t top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+      const Node& node = nodes_[stack[--top]];
+      if (squaredBoxDistance_(node, x) >= best) continue;
+
+      if (node.count > 0) {
+        for (std::size_t i = node.first; i < node.first + node.count; ++i)
+          best = std::min(best, squaredDistance_(x, primitives_[i]));
+        continue;
+      }
+
+      // push the nearer child last to visit it first
+      const std::uint32_t left = node.first;
+      const std::uint32_t right = node.first + 1;
+      if (squaredBoxDistance_(nodes_[left], x) <
+          squaredBoxDistance_(nodes_[right], x)) {
+        stack[top++] = right;
+        stack[top++] = left;
+      } else {
+        stack[top++] = left;
+        stack[top++] = right;
+      }
+    }
+
+    return best;
+  }
+
+ private:
+  //! Leaf if count > 0, otherwise the children are first and first + 1
+  struct Node {
+    GlobalCoordinate lower, upper;
+    std::uint32_t first = 0;
+    std::uint32_t count = 0;
+  };
+
+  void build_(std::size_t node, std::size_t begin, std::size_t end) {
+    GlobalCoordinate lower(std::numeric_limits<ctype>::max());
+    GlobalCoordinate upper(std::numeric_limits<ctype>::lowest());
+    GlobalCoordinate cLower = lower, cUpper = upper;
+    for (std::size_t i = begin; i < end; ++i) {
+      const GlobalCoordinate c = center_(primitives_[i]);
+      for (int d = 0; d < dim; ++d) {
+        for (const auto& p : primitives_[i]) {
+          lower[d] = std::min(lower[d], p[d]);
+          upper[d] = std::max(upper[d], p[d]);
+        }
+        cLower[d] = std::min(cLower[d], c[d]);
+        cUpper[d] = std::max(cUpper[d], c[d]);
+      }
+    }
+    nodes_[node].lower = lower;
+    nodes_[node].upper = upper;
+
+    if (end - begin <= leafSize) {
+      nodes_[node].first = begin;
+      nodes_[node].count = end - begin;
+      return;
+    }
+
+    // split at the median along the longest axis of the centers
+    int axis = 0;
+    for (int d = 1; d < dim; ++d)
+      if (cUpper[d] - cLower[d] > cUpper[axis] - cLower[axis]) axis = d;
+
+    const std::size_t mid = (begin + end) / 2;
+    std::nth_element(primitives_.begin() + begin, primitives_.begin() + mid,
+                     primitives_.begin() + end,
+                     [axis](const Primitive& a, const Primitive& b) {
+                       return center_(a)[axis] < center_(b)[axis];
+                     });
+
+    const std::size_t left = nodes_.size();
+    nodes_.emplace_back();
+    nodes_.emplace_back();
+    nodes_[node].first = left;
+    nodes_[node].count = 0;
+
+    build_(left, begin, mid);
+    build_(left + 1, mid, end);
+  }
+
+  static GlobalCoordinate center_(const Primitive& p) {
+    GlobalCoordinate c(0.0);
+    for (const auto& x : p) c += x;
+    c /= dim;
+    return c;
+  }
+
+  static ctype squaredBoxDistance_(const Node& node,
+                                   const GlobalCoordinate& x) {
+    ctype dist = 0.0;
+    for (int d = 0; d < dim; ++d) {
+      const ctype v = std::max({node.lower[d] - x[d], x[d] - node.upper[d],
+                                ctype(0.0)});
+      dist += v * v;
+    }
+    return dist;
+  }
+
+  static ctype squaredDistance_(const GlobalCoordinate& x, const Primitive& p) {
+    if constexpr (dim == 2)
+      return MMeshImpl::squaredDistanceToSegment(x, p[0], p[1]);
+    else
+      return MMeshImpl::squaredDistanceToTriangle(x, p[0], p[1], p[2]);
+  }
+
+  std::vector<Primitive> primitives_;
+  std::vector<Node> nodes_;
+};
+
+}  // end namespace Dune
+
+#endif
@@ -11,7 +11,15 @@
 
 #include <dune/common/exceptions.hh>
 #include <dune/grid/common/partitionset.hh>
+#include <dune/mmesh/misc/parallelfor.hh>
+#include <dune/mmesh/remeshing/boundingvolumehierarchy.hh>
+#include <algorithm>
+#include <cstdint>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace Dune {
 
@@ -28,8 +36,10 @@ class Distance {
   using Vertex = typename Grid::Vertex;
   using Element = typename Grid::template Codim<0>::Entity;
   using Facet = typename Grid::template Codim<1>::Entity;
+  using Intersection = typename Grid::Intersection;
   using InterfaceElement =
       typename Grid::InterfaceGrid::template Codim<0>::Entity;
+  using BoundingVolumeHierarchy = MMeshBoundingVolumeHierarchy<dim, ctype>;
 
  public:
   //! Default constructor
@@ -38,26 +48,140 @@ class Distance {
   //! Constructor with grid reference
   Distance(const Grid& grid) : grid_(&grid), initialized_(false) {}
 
-  //! Update the distances of all vertices
+  /*!
+   * \brief Update the distances of all vertices
+   *
+   * The interface elements are stored in a bounding volume hierarchy and the
+   * exact distances of the interior vertices are evaluated. If a band width
+   * is set, only the vertices inside the band are evaluated by a front
+   * propagation starting at the interface, all other vertices obtain the
+   * band width as value. If incremental updates are enabled, only the
+   * vertices around the changes registered since the last update are
+   * evaluated. If signed distances are enabled, the phases are classified
+   * in the same update, incrementally only around the registered changes.
+   */
   void update() {
-    // Resize distance_ and set to high default value
-    distances_.resize(indexSet().size(dim));
-    std::fill(distances_.begin(), distances_.end(), 1e100);
+    buildHierarchy_();
 
-    // Set all interface vertices to zero and initialize queue
+    const bool incremental = incremental_ && initialized_ && !invalid_;
+    if (incremental) {
+      if (indicesChanged_) remapIndices_();
+      buildChangedHierarchy_();
+      propagate_(changedBvh_, shift_);
+    } else
+      updateAll_();
 
-    for (const InterfaceElement& ielement : elements(
-             grid_->interfaceGrid().leafGridView(), Partitions::interior)) {
-      // Convert to bulk facet
-      const Facet facet = grid_->entity(ielement.impl().hostEntity());
-
-      // Compute vertex distances to this facet
-      handleFacet(facet);
-    }
+    if (signed_) {
+      if (incremental && classified_ && classifiable_)
+        reclassify_();
+      else
+        classify_();
+    } else
+      classified_ = false;
 
+    seeds_.clear();
+    seedIds_.clear();
+    shift_ = 0.0;
+    indicesChanged_ = false;
+    invalid_ = false;
     initialized_ = true;
   };
 
+  /*!
+   * \brief Enable the incremental update
+   *
+   * The grid registers moved, inserted and removed vertices and only the
+   * distances that might change are recomputed. The propagation passes all
+   * vertices that are closer to the interface elements around the changes
+   * than their previous distance plus the registered shift, hence, the result
+   * coincides with a full update.
+   */
+  void setIncremental(bool incremental = true) {
+    incremental_ = incremental;
+    invalid_ = true;
+  }
+
+  //! Return if the incremental update is enabled
+  bool incremental() const { return incremental_; }
+
+  /*!
+   * \brief Set the width of the band around the interface
+   *
+   * Vertices farther away than the band width obtain the band width as
+   * distance. The propagation passes the vertices slightly outside the band,
+   * hence, the vertices inside the band obtain their exact distance.
+   */
+  void setBandWidth(ctype bandWidth) {
+    bandWidth_ = bandWidth;
+    invalid_ = true;
+  }
+
+  //! Return the band width
+  ctype bandWidth() const { return bandWidth_; }
+
+  /*!
+   * \brief Enable the signed distance and the phase classification
+   *
+   * The elements are classified by a traversal that switches the phase at
+   * each interface facet. The phase of the elements at the domain boundary
+   * is 0 and has positive distance, regions enclosed by the interface have
+   * phase 1 and negative distance. The classification is only meaningful if
+   * the interface is closed or separates the domain, otherwise classifiable()
+   * returns false.
+   */
+  void setSigned(bool isSigned = true) {
+    if (isSigned && !signed_ && initialized_) {
+      signed_ = true;
+      classify_();
+    }
+    signed_ = isSigned;
+  }
+
+  //! Return if the signed distance is enabled
+  bool isSigned() const { return signed_; }
+
+  /*!
+   * \brief Return if the phases are consistent
+   *
+   * This is false if the traversal reached an element with both phases,
+   * e.g., because the interface ends inside the domain.
+   */
+  bool classifiable() const {
+    assert(initialized_ && signed_);
+    return classifiable_;
+  }
+
+  /*!
+   * \brief Register a vertex that has been moved or whose neighborhood
+   * of the interface has changed
+   *
+   * \param vertex    A grid vertex
+   * \param shift     Bound of the movement of the incident interface elements
+   */
+  void changed(const Vertex& vertex, ctype shift = 0.0) {
+    if (!incremental_ || !initialized_) return;
+
+    shift_ = std::max(shift_, shift);
+    if (indicesChanged_)
+      seedIds_.insert(vertex.impl().hostEntity()->info().id);
+    else
+      seeds_.push_back(vertex);
+  }
+
+  //! Notify that the vertex indices change, e.g. before adaptation
+  void indicesChanged() {
+    if (!incremental_ || !initialized_) return;
+
+    // the registered vertices might be removed, hence, we store their ids
+    for (const auto& vertex : seeds_)
+      seedIds_.insert(vertex.impl().hostEntity()->info().id);
+    seeds_.clear();
+    indicesChanged_ = true;
+  }
+
+  //! Enforce the update of all vertices
+  void invalidate() { invalid_ = true; }
+
   //! Return if distance has been initialized
   bool initialized() const { return initialized_; }
 
@@ -103,6 +227,46 @@ class Distance {
   //! Interface element
   ctype operator()(const InterfaceElement& element) const { return 0.0; }
 
+  //! Return the signed distance of a vertex, negative in phase 1
+  ctype signedDistance(const Vertex& vertex) const {
+    assert(initialized_ && signed_);
+    const std::size_t index = indexSet().index(vertex);
+    return vertexPhases_[index] ? -distances_[index] : distances_[index];
+  }
+
+  /*!
+   * \brief Return the signed distance of an element (average of the signed
+   * vertex distances)
+   *
+   * \param element    A grid element
+   */
+  ctype signedDistance(const Element& element) const {
+    ctype dist = 0.0;
+    for (std::size_t i = 0; i < dim + 1; ++i)
+      dist += signedDistance(element.template subEntity<dim>(i));
+    dist /= dim + 1;
+    return dist;
+  }
+
+  //! Return the phase (0 or 1) of an element
+  int phase(const Element& element) const {
+    assert(initialized_ && signed_);
+    return phases_[indexSet().index(element)];
+  }
+
+  /*!
+   * \brief Return the unit normal of an interface element pointing from
+   * phase 1 to phase 0, i.e., the gradient of the signed distance
+   *
+   * \param element    An interface element
+   */
+  GlobalCoordinate normal(const InterfaceElement& element) const {
+    const Intersection intersection = grid_->asIntersection(element);
+    GlobalCoordinate n = intersection.centerUnitOuterNormal();
+    if (phase(intersection.inside()) == 0) n *= -1.0;
+    return n;
+  }
+
   /*!
    * \brief function call operator to return distance
    *
@@ -129,60 +293,353 @@ class Distance {
   }
 
  private:
-  //! Handle facet: Compute all vertex distances
-  void handleFacet(const Facet& facet) {
-    for (const auto& v :
-         vertices(grid_->leafGridView(), Partitions::interior)) {
-      ctype dist = computeDistance(v, facet);
-      ctype& currentDist = distances_[indexSet().index(v)];
-      if (dist < currentDist) currentDist = dist;
+  //! Build the hierarchy of the interface elements
+  void buildHierarchy_() {
+    std::vector<typename BoundingVolumeHierarchy::Primitive> primitives;
+    for (const InterfaceElement& ielement : elements(
+             grid_->interfaceGrid().leafGridView(), Partitions::interior)) {
+      const auto& geo = ielement.geometry();
+      typename BoundingVolumeHierarchy::Primitive primitive;
+      for (std::size_t i = 0; i < dim; ++i) primitive[i] = geo.corner(i);
+      primitives.push_back(primitive);
     }
+    bvh_.build(std::move(primitives));
   }
 
-  //! Compute vertex distance value
-  ctype computeDistance(const Vertex& v, const Facet& facet) const {
-    GlobalCoordinate vp = v.geometry().center();
-    const auto& geo = facet.geometry();
+  //! Build the hierarchy of the interface elements incident to the seeds
+  void buildChangedHierarchy_() {
+    std::vector<typename BoundingVolumeHierarchy::Primitive> primitives;
+    for (const auto& v : seeds_) {
+      if (!v.impl().isInterface()) continue;
 
-    if constexpr (dim == 2) {
-      for (std::size_t i = 0; i < dim; ++i) {
-        const GlobalCoordinate& vi = geo.corner(i);
-        const GlobalCoordinate& vj = geo.corner(1 - i);
-        ctype sgn = (vi - vj) * (vp - vi);
-        if (sgn >= 0) return (vp - vi).two_norm();
+      const auto ivertex = grid_->interfaceGrid().entity(v.impl().hostEntity());
+      for (const auto& ielement : incidentInterfaceElements(ivertex)) {
+        const auto& geo = ielement.geometry();
+        typename BoundingVolumeHierarchy::Primitive primitive;
+        for (std::size_t i = 0; i < dim; ++i) primitive[i] = geo.corner(i);
+        primitives.push_back(primitive);
       }
+    }
+    changedBvh_.build(std::move(primitives));
+  }
+
+  //! Return the distance of x capped by the band width
+  ctype evaluate_(const GlobalCoordinate& x) const {
+    return std::min(bandWidth_, bvh_.distance(x));
+  }
+
+  //! Compute the distances of all vertices
+  void updateAll_() {
+    // Resize distance_ and set to high default value
+    distances_.resize(indexSet().size(dim));
+    std::fill(distances_.begin(), distances_.end(), bandWidth_);
+
+    if (!bvh_.empty()) {
+      if (bandWidth_ < infinity) {
+        // Propagate the band starting at the interface vertices
+        for (const auto& ivertex :
+             vertices(grid_->interfaceGrid().leafGridView()))
+          seeds_.push_back(grid_->entity(ivertex.impl().hostEntity()));
+        propagate_(bvh_, 0.0);
+      } else {
+        // Gather the interior vertices
+        points_.clear();
+        indices_.clear();
+        for (const auto& v :
+             vertices(grid_->leafGridView(), Partitions::interior)) {
+          points_.push_back(v.geometry().center());
+          indices_.push_back(indexSet().index(v));
+        }
+
+        // Compute vertex distances
+        MMeshImpl::parallelFor(points_.size(), [this](std::size_t i) {
+          distances_[indices_[i]] = evaluate_(points_[i]);
+        });
+      }
+    }
+
+    // Store the vertex ids to map the distances after adaptation
+    if (incremental_) {
+      ids_.resize(distances_.size());
+      for (const auto& v : vertices(grid_->leafGridView()))
+        ids_[indexSet().index(v)] = v.impl().hostEntity()->info().id;
+    }
+  }
+
+  //! Map the distances and vertex phases to the new vertex indices, inserted
+  //! vertices and the vertices registered by id become seeds
+  void remapIndices_() {
+    std::unordered_map<std::size_t, std::pair<ctype, std::int8_t>> previous;
+    previous.reserve(ids_.size());
+    for (std::size_t i = 0; i < ids_.size(); ++i)
+      previous.emplace(ids_[i],
+                       std::make_pair(distances_[i], classified_
+                                                         ? vertexPhases_[i]
+                                                         : unclassified));
+
+    distances_.assign(indexSet().size(dim), bandWidth_);
+    if (classified_) vertexPhases_.assign(distances_.size(), unclassified);
+    ids_.resize(distances_.size());
+    for (const auto& v : vertices(grid_->leafGridView())) {
+      const std::size_t index = indexSet().index(v);
+      const std::size_t id = v.impl().hostEntity()->info().id;
+      ids_[index] = id;
+
+      auto it = previous.find(id);
+      if (it != previous.end()) {
+        distances_[index] = it->second.first;
+        if (classified_) vertexPhases_[index] = it->second.second;
+      } else
+        seeds_.push_back(v);
+
+      if (seedIds_.count(id) > 0) seeds_.push_back(v);
+    }
+  }
+
+  /*!
+   * \brief Evaluate the seeds and propagate to the vertices whose distance
+   * might change, the vertices of each front are evaluated in parallel
+   *
+   * A vertex x can only change if dist(x, changedElements) <= d(x) + shift,
+   * where d is the previous distance. Both sides are 1-Lipschitz, hence, this
+   * region is reached from the seeds via vertices that violate the bound by
+   * at most twice their longest edge.
+   *
+   * \param changedElements The interface elements around the changes
+   * \param shift           Bound of the movement of the changed elements
+   */
+  void propagate_(const BoundingVolumeHierarchy& changedElements,
+                  ctype shift) {
+    // we use a stamp to avoid clearing the visited flags
+    visited_.resize(distances_.size(), 0);
+    if (++stamp_ == 0) {
+      std::fill(visited_.begin(), visited_.end(), 0);
+      stamp_ = 1;
+    }
+
+    queue_.clear();
+    auto push = [this](const Vertex& v) {
+      std::uint32_t& visited = visited_[indexSet().index(v)];
+      if (visited == stamp_) return;
+      visited = stamp_;
+      queue_.push_back(v);
+    };
+
+    for (const auto& v : seeds_) push(v);
+    const std::size_t numSeeds = queue_.size();
+
+    for (std::size_t begin = 0; begin < queue_.size();) {
+      const std::size_t end = queue_.size();
+
+      // Gather the interior vertices of the front
+      front_.clear();
+      points_.clear();
+      indices_.clear();
+      for (std::size_t q = begin; q < end; ++q)
+        if (queue_[q].partitionType() == InteriorEntity) {
+          front_.push_back(q);
+          points_.push_back(queue_[q].geometry().center());
+          indices_.push_back(indexSet().index(queue_[q]));
+        }
+
+      // Compute the distances of the front, each vertex is visited once
+      changed_.assign(front_.size(), 0);
+      margins_.resize(front_.size());
+      MMeshImpl::parallelFor(front_.size(), [&](std::size_t i) {
+        // if all elements changed, the exact distance is the region distance
+        const ctype exact = bvh_.distance(points_[i]);
+        const ctype region = (&changedElements == &bvh_)
+                                 ? exact
+                                 : changedElements.distance(points_[i]);
+        const ctype dist = std::min(bandWidth_, exact);
+        margins_[i] = region - distances_[indices_[i]] - shift;
+        changed_[i] = (dist != distances_[indices_[i]]);
+        distances_[indices_[i]] = dist;
+      });
+
+      // The next front are the neighbors of the seeds, of the vertices whose
+      // distance changed and of the vertices near the affected region
+      for (std::size_t i = 0; i < front_.size(); ++i) {
+        const Vertex vertex = queue_[front_[i]];
+        if (!changed_[i] && front_[i] >= numSeeds) {
+          ctype h = 0.0;
+          for (const auto& neighbor : incidentVertices(vertex)) {
+            GlobalCoordinate d = neighbor.geometry().center();
+            d -= points_[i];
+            h = std::max(h, d.two_norm());
+          }
+          if (margins_[i] > 2.0 * h) continue;
+        }
 
-      Dune::Plane<GlobalCoordinate> plane(geo.corner(0), geo.corner(1));
-      return std::abs(plane.signedDistance(vp));
-    } else  // dim == 3
-    {
-      // We only use an estimate for 3d.
-      ctype dist = 1e100;
-      for (std::size_t i = 0; i < dim; ++i) {
-        const GlobalCoordinate& vi = geo.corner(i);
-        dist = std::min(dist, (vp - vi).two_norm2());
-
-        const GlobalCoordinate& vj = geo.corner((i + 1) % dim);
-        dist = std::min(dist, (vp - 0.5 * (vi + vj)).two_norm2());
+        for (const auto& neighbor : incidentVertices(vertex)) push(neighbor);
       }
 
-      const GlobalCoordinate& vc = geo.center();
-      dist = std::min(dist, (vp - vc).two_norm2());
+      begin = end;
+    }
+  }
+
+  //! Classify the elements and vertices into phases by a traversal that
+  //! switches the phase across interface facets
+  void classify_() {
+    const auto& gridView = grid_->leafGridView();
+    phases_.assign(indexSet().size(0), unclassified);
+    vertexPhases_.assign(indexSet().size(dim), 0);
+    classifiable_ = true;
+    classified_ = true;
+
+    // start at the domain boundary, other parts (e.g. in parallel) start
+    // with phase 0 as well
+    for (const auto& element : elements(gridView)) {
+      bool boundary = false;
+      for (const auto& intersection : intersections(gridView, element))
+        boundary |= intersection.boundary();
+
+      if (boundary) {
+        flood_(element, 0);
+        break;
+      }
+    }
+
+    for (const auto& element : elements(gridView))
+      if (phases_[indexSet().index(element)] == unclassified)
+        flood_(element, 0);
+  }
+
+  //! Reclassify the elements incident to the seeds, after adaptation the
+  //! other elements take the phase of a vertex away from the interface
+  void reclassify_() {
+    const auto& gridView = grid_->leafGridView();
 
-      return std::sqrt(dist);
+    // the phase of the seeds is not known
+    for (const auto& v : seeds_)
+      vertexPhases_[indexSet().index(v)] = unclassified;
+
+    pending_.clear();
+    if (indicesChanged_) {
+      phases_.assign(indexSet().size(0), unclassified);
+      for (const auto& element : elements(gridView)) {
+        std::int8_t& phase = phases_[indexSet().index(element)];
+        for (std::size_t i = 0; i < dim + 1 && phase == unclassified; ++i) {
+          const auto& vertex = element.template subEntity<dim>(i);
+          if (!vertex.impl().isInterface())
+            phase = vertexPhases_[indexSet().index(vertex)];
+        }
+        if (phase == unclassified) pending_.push_back(element);
+      }
     }
 
-    DUNE_THROW(InvalidStateException, "Compute distance failed");
-    return -1.;
+    for (const auto& v : seeds_)
+      for (const auto& element : incidentElements(v)) {
+        std::int8_t& phase = phases_[indexSet().index(element)];
+        if (phase == unclassified) continue;
+        phase = unclassified;
+        pending_.push_back(element);
+      }
+
+    // the pending elements take the phase of a classified neighbor
+    elementQueue_.clear();
+    for (const auto& element : pending_)
+      for (const auto& intersection : intersections(gridView, element)) {
+        if (!intersection.neighbor()) continue;
+
+        const std::int8_t other =
+            phases_[indexSet().index(intersection.outside())];
+        if (other == unclassified) continue;
+
+        phases_[indexSet().index(element)] =
+            grid_->isInterface(intersection) ? 1 - other : other;
+        elementQueue_.push_back(element);
+        break;
+      }
+    flood_();
+
+    for (const auto& element : pending_)
+      if (phases_[indexSet().index(element)] == unclassified)
+        flood_(element, 0);
+  }
+
+  //! Start the traversal at the given element
+  void flood_(const Element& seed, std::int8_t phase) {
+    elementQueue_.clear();
+    elementQueue_.push_back(seed);
+    phases_[indexSet().index(seed)] = phase;
+    flood_();
+  }
+
+  //! Classify all unclassified elements reachable from the queued elements,
+  //! a classified neighbor with the wrong phase is reported by classifiable()
+  void flood_() {
+    const auto& gridView = grid_->leafGridView();
+    for (std::size_t q = 0; q < elementQueue_.size(); ++q) {
+      const Element element = elementQueue_[q];
+      const std::int8_t p = phases_[indexSet().index(element)];
+
+      // interface vertices have zero distance, hence, their phase does not
+      // matter and all other vertices are inside a single phase
+      for (std::size_t i = 0; i < dim + 1; ++i) {
+        const auto& vertex = element.template subEntity<dim>(i);
+        vertexPhases_[indexSet().index(vertex)] = p;
+      }
+
+      for (const auto& intersection : intersections(gridView, element)) {
+        if (!intersection.neighbor()) continue;
+
+        const std::int8_t expected =
+            grid_->isInterface(intersection) ? 1 - p : p;
+        const Element neighbor = intersection.outside();
+        std::int8_t& other = phases_[indexSet().index(neighbor)];
+        if (other == unclassified) {
+          other = expected;
+          elementQueue_.push_back(neighbor);
+        } else if (other != expected)
+          classifiable_ = false;
+      }
+    }
+    elementQueue_.clear();
   }
 
   const typename Grid::LeafIndexSet& indexSet() const {
     return grid_->leafIndexSet();
   }
 
+  //! The default distance of vertices without interface
+  static constexpr ctype infinity = 1e100;
+
+  //! The phase of elements and vertices that are not classified yet
+  static constexpr std::int8_t unclassified = -1;
+
   std::vector<ctype> distances_;
-  const Grid* grid_;
-  bool initialized_;
+  BoundingVolumeHierarchy bvh_;
+  std::vector<GlobalCoordinate> points_;
+  std::vector<std::size_t> indices_;
+  const Grid* grid_ = nullptr;
+  bool initialized_ = false;
+
+  // data for the band and the incremental update
+  ctype bandWidth_ = infinity;
+  bool incremental_ = false;
+  bool invalid_ = false;
+  bool indicesChanged_ = false;
+  std::vector<Vertex> seeds_;
+  std::unordered_set<std::size_t> seedIds_;
+  std::vector<std::size_t> ids_;
+  std::vector<Vertex> queue_;
+  std::vector<std::size_t> front_;
+  std::vector<std::uint8_t> changed_;
+  std::vector<ctype> margins_;
+  BoundingVolumeHierarchy changedBvh_;
+  ctype shift_ = 0.0;
+  std::vector<std::uint32_t> visited_;
+  std::uint32_t stamp_ = 0;
+
+  // data for the signed distance
+  bool signed_ = false;
+  std::vector<std::int8_t> phases_;
+  std::vector<std::int8_t> vertexPhases_;
+  bool classified_ = false;
+  bool classifiable_ = true;
+  std::vector<Element> elementQueue_;
+  std::vector<Element> pending_;
 };
 
 }  // end namespace Dune
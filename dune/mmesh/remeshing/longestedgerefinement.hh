@@ -11,7 +11,9 @@
 
 #include <dune/common/exceptions.hh>
 #include <dune/grid/common/partitionset.hh>
+#include <map>
 #include <memory>
+#include <type_traits>
 
 namespace Dune {
 
@@ -153,6 +155,21 @@ class LongestEdgeRefinement {
   //! return if interface vertex is neither a tip nor a junction
   template <class Vertex>
   static inline bool isRemoveable(const Vertex& vertex) {
+    // in 3d, the incident interface elements have to form a disk, i.e. every
+    // adjacent interface vertex is shared by exactly two of them
+    if constexpr (Vertex::dimension == 2) {
+      std::map<std::decay_t<decltype(vertex.impl().hostEntity())>, int> count;
+      for (const auto& element : incidentInterfaceElements(vertex))
+        for (std::size_t i = 0; i < element.subEntities(2); ++i) {
+          const auto& v = element.template subEntity<2>(i);
+          if (v != vertex) count[v.impl().hostEntity()]++;
+        }
+
+      for (const auto& c : count)
+        if (c.second != 2) return false;
+      return (count.size() >= 3);
+    }
+
     int count = 0;
     for (const auto& edge : incidentInterfaceElements(vertex)) {
       std::ignore = edge;
@@ -0,0 +1,360 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+/*!
+ * \file
+ * \ingroup MMesh Remeshing
+ * \brief   Class for extending interface shifts to the bulk vertices.
+ */
+
+#ifndef DUNE_MMESH_REMESHING_MESHMOTION_HH
+#define DUNE_MMESH_REMESHING_MESHMOTION_HH
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/mmesh/misc/parallelfor.hh>
+#include <dune/mmesh/remeshing/distance.hh>
+
+namespace Dune {
+
+/*!
+ * \ingroup MMesh Remeshing
+ * \brief   Class for extending interface shifts to the bulk vertices.
+ *
+ * The bulk shifts solve a discrete Laplace (harmonic extension) or linear
+ * elasticity problem with piecewise linear elements. The interface vertices
+ * obtain the interface shifts, the boundary vertices and the vertices
+ * outside of the band around the interface stay fixed. The weight of a cell
+ * is |T|^(1 - stiffening), i.e. a positive stiffening makes small cells
+ * stiffer such that they are deformed less.
+ *
+ * The system is solved by a Jacobi preconditioned conjugate gradient method
+ * that applies the operator matrix-free. The gradients of the basis
+ * functions are stored per cell and each unknown gathers its row from the
+ * cells of its star, such that the application runs in parallel.
+ */
+template <class Grid>
+class MMeshMotion {
+  static constexpr int dim = Grid::dimension;
+  using ctype = typename Grid::ctype;
+  using GlobalCoordinate = FieldVector<ctype, dim>;
+  using Cell = std::array<std::uint32_t, dim + 1>;
+  using Gradients = std::array<GlobalCoordinate, dim + 1>;
+
+ public:
+  //! The operator of the mesh motion problem
+  enum class Operator { laplace, elasticity };
+
+  //! Constructor with grid reference
+  explicit MMeshMotion(const Grid& grid) : grid_(grid), distance_(grid) {}
+
+  //! Set the operator of the mesh motion problem
+  void setOperator(Operator op) { operator_ = op; }
+
+  //! Return the operator of the mesh motion problem
+  Operator getOperator() const { return operator_; }
+
+  //! Set the Poisson ratio of the elasticity operator, in [0, 0.5)
+  void setPoissonRatio(ctype nu) { nu_ = nu; }
+
+  //! Return the Poisson ratio of the elasticity operator
+  ctype poissonRatio() const { return nu_; }
+
+  //! Set the stiffening exponent, 0 is the unweighted problem
+  void setStiffening(ctype stiffening) { stiffening_ = stiffening; }
+
+  //! Return the stiffening exponent
+  ctype stiffening() const { return stiffening_; }
+
+  //! Restrict the unknowns to a band around the interface, a non-finite
+  //! band width removes the restriction
+  void setBandWidth(ctype bandWidth) {
+    band_ = std::isfinite(bandWidth);
+    if (band_) distance_.setBandWidth(bandWidth);
+  }
+
+  //! Return the band width, infinity if the problem is not restricted
+  ctype bandWidth() const { return band_ ? distance_.bandWidth() : infinity_; }
+
+  //! Set the relative tolerance of the conjugate gradient method
+  void setTolerance(ctype tolerance) { tolerance_ = tolerance; }
+
+  //! Set the maximal number of iterations of the conjugate gradient method
+  void setMaxIterations(int maxIterations) { maxIterations_ = maxIterations; }
+
+  //! Return the number of iterations of the last solve
+  int iterations() const { return iterations_; }
+
+  //! Return the relative residual of the last solve
+  ctype residual() const { return residual_; }
+
+  /*!
+   * \brief Return the shifts of all vertices
+   *
+   * \param interfaceShifts  Vector that maps interface vertex index to shift
+   * \return Vector that maps vertex index to shift, can be passed to
+   *         moveVertices
+   */
+  std::vector<GlobalCoordinate> shifts(
+      const std::vector<GlobalCoordinate>& interfaceShifts) {
+    const auto& indexSet = grid_.leafIndexSet();
+    const auto& iindexSet = grid_.interfaceGrid().leafIndexSet();
+    assert(interfaceShifts.size() == iindexSet.size(dim - 1));
+
+    gather_(interfaceShifts);
+    solve_();
+
+    std::vector<GlobalCoordinate> result(indexSet.size(dim),
+                                         GlobalCoordinate(0.0));
+    for (const auto& vertex : vertices(grid_.leafGridView()))
+      if (vertex.impl().isInterface())
+        result[indexSet.index(vertex)] = interfaceShifts[iindexSet.index(
+            grid_.interfaceGrid().entity(vertex.impl().hostEntity()))];
+
+    for (std::size_t i = 0; i < size_; ++i) result[indices_[i]] = u_[i];
+    return result;
+  }
+
+ private:
+  //! Gather the unknowns, their stars and the cell gradients
+  void gather_(const std::vector<GlobalCoordinate>& interfaceShifts) {
+    const auto& indexSet = grid_.leafIndexSet();
+    const auto& iindexSet = grid_.interfaceGrid().leafIndexSet();
+    if (band_) distance_.update();
+
+    localId_.assign(indexSet.size(dim), -1);
+    vertices_.clear();
+    indices_.clear();
+    for (const auto& vertex : vertices(grid_.leafGridView())) {
+      if (vertex.impl().isInterface()) continue;
+      if (Grid::RefinementStrategy::atBoundary(vertex)) continue;
+      if (band_ && !(distance_(vertex) < distance_.bandWidth())) continue;
+
+      localId_[indexSet.index(vertex)] = indices_.size();
+      vertices_.push_back(vertex);
+      indices_.push_back(indexSet.index(vertex));
+    }
+    size_ = indices_.size();
+
+    // the Dirichlet vertices obtain local ids after the unknowns
+    u_.assign(size_, GlobalCoordinate(0.0));
+    cellId_.assign(indexSet.size(0), -1);
+    cells_.clear();
+    gradients_.clear();
+    weights_.clear();
+    starOffsets_.assign(1, 0);
+    starCells_.clear();
+    for (std::size_t i = 0; i < size_; ++i) {
+      for (const auto& element : incidentElements(vertices_[i])) {
+        const std::size_t elementIndex = indexSet.index(element);
+        if (cellId_[elementIndex] < 0) {
+          cellId_[elementIndex] = cells_.size();
+          addCell_(element, interfaceShifts, iindexSet);
+        }
+        starCells_.push_back(cellId_[elementIndex]);
+      }
+      starOffsets_.push_back(starCells_.size());
+    }
+  }
+
+  //! Add the local ids, the gradients and the weight of a cell
+  template <class Element, class InterfaceIndexSet>
+  void addCell_(const Element& element,
+                const std::vector<GlobalCoordinate>& interfaceShifts,
+                const InterfaceIndexSet& iindexSet) {
+    const auto& indexSet = grid_.leafIndexSet();
+    const auto& geo = element.geometry();
+
+    Cell cell;
+    for (int k = 0; k < dim + 1; ++k) {
+      const auto& v = element.template subEntity<dim>(k);
+      const std::size_t index = indexSet.index(v);
+      if (localId_[index] < 0) {
+        localId_[index] = u_.size();
+        indices_.push_back(index);
+        GlobalCoordinate value(0.0);
+        if (v.impl().isInterface())
+          value = interfaceShifts[iindexSet.index(
+              grid_.interfaceGrid().entity(v.impl().hostEntity()))];
+        u_.push_back(value);
+      }
+      cell[k] = localId_[index];
+    }
+    cells_.push_back(cell);
+
+    // the gradient of the k-th barycentric coordinate is the k-th column of
+    // the inverse of the matrix with the rows p_k - p_0
+    FieldMatrix<ctype, dim, dim> jacobian;
+    for (int k = 0; k < dim; ++k)
+      jacobian[k] = geo.corner(k + 1) - geo.corner(0);
+    const ctype volume = std::abs(jacobian.determinant()) / factorial_();
+    jacobian.invert();
+
+    Gradients gradients;
+    gradients[0] = 0.0;
+    for (int k = 0; k < dim; ++k) {
+      for (int a = 0; a < dim; ++a) gradients[k + 1][a] = jacobian[a][k];
+      gradients[0] -= gradients[k + 1];
+    }
+    gradients_.push_back(gradients);
+    weights_.push_back(std::pow(volume, 1.0 - stiffening_));
+  }
+
+  //! Compute y = A u for the rows of the unknowns
+  void apply_(const std::vector<GlobalCoordinate>& u,
+              std::vector<GlobalCoordinate>& y) const {
+    const ctype mu = 0.5 / (1.0 + nu_);
+    const ctype lambda = nu_ / ((1.0 + nu_) * (1.0 - 2.0 * nu_));
+
+    MMeshImpl::parallelFor(size_, [&](std::size_t i) {
+      GlobalCoordinate row(0.0);
+      for (std::size_t s = starOffsets_[i]; s < starOffsets_[i + 1]; ++s) {
+        const std::size_t c = starCells_[s];
+        const Cell& cell = cells_[c];
+        const Gradients& g = gradients_[c];
+        const GlobalCoordinate& gi = g[corner_(cell, i)];
+
+        GlobalCoordinate local(0.0);
+        for (int j = 0; j < dim + 1; ++j) {
+          const GlobalCoordinate& uj = u[cell[j]];
+          if (operator_ == Operator::laplace)
+            local.axpy(gi * g[j], uj);
+          else {
+            local.axpy(mu * (gi * g[j]), uj);
+            local.axpy(mu * (gi * uj), g[j]);
+            local.axpy(lambda * (g[j] * uj), gi);
+          }
+        }
+        row.axpy(weights_[c], local);
+      }
+      y[i] = row;
+    });
+  }
+
+  //! Compute the inverse diagonal of the operator
+  void invertDiagonal_(std::vector<GlobalCoordinate>& d) const {
+    const ctype mu = 0.5 / (1.0 + nu_);
+    const ctype lambda = nu_ / ((1.0 + nu_) * (1.0 - 2.0 * nu_));
+
+    d.assign(size_, GlobalCoordinate(0.0));
+    for (std::size_t i = 0; i < size_; ++i) {
+      for (std::size_t s = starOffsets_[i]; s < starOffsets_[i + 1]; ++s) {
+        const std::size_t c = starCells_[s];
+        const GlobalCoordinate& gi = gradients_[c][corner_(cells_[c], i)];
+        for (int a = 0; a < dim; ++a)
+          if (operator_ == Operator::laplace)
+            d[i][a] += weights_[c] * gi.two_norm2();
+          else
+            d[i][a] += weights_[c] * (mu * (gi.two_norm2() + gi[a] * gi[a]) +
+                                      lambda * gi[a] * gi[a]);
+      }
+      for (int a = 0; a < dim; ++a) d[i][a] = 1.0 / d[i][a];
+    }
+  }
+
+  //! Solve for the unknowns by the preconditioned conjugate gradient method
+  void solve_() {
+    iterations_ = 0;
+    residual_ = 0.0;
+    if (size_ == 0) return;
+
+    // the right hand side is -A u with the Dirichlet values
+    std::vector<GlobalCoordinate> r(size_), z(size_), q(size_), d;
+    apply_(u_, r);
+    for (auto& ri : r) ri *= -1.0;
+
+    const ctype norm = std::sqrt(dot_(r, r));
+    if (norm == 0.0) return;
+
+    // the direction has zero Dirichlet values
+    std::vector<GlobalCoordinate> p(u_.size(), GlobalCoordinate(0.0));
+    invertDiagonal_(d);
+    precondition_(d, r, z);
+    for (std::size_t i = 0; i < size_; ++i) p[i] = z[i];
+    ctype rz = dot_(r, z);
+
+    residual_ = 1.0;
+    while (iterations_ < maxIterations_ && residual_ > tolerance_) {
+      apply_(p, q);
+      const ctype alpha = rz / dot_(p, q);
+      for (std::size_t i = 0; i < size_; ++i) {
+        u_[i].axpy(alpha, p[i]);
+        r[i].axpy(-alpha, q[i]);
+      }
+
+      ++iterations_;
+      residual_ = std::sqrt(dot_(r, r)) / norm;
+
+      precondition_(d, r, z);
+      const ctype rzNew = dot_(r, z);
+      const ctype beta = rzNew / rz;
+      rz = rzNew;
+      for (std::size_t i = 0; i < size_; ++i) {
+        p[i] *= beta;
+        p[i] += z[i];
+      }
+    }
+  }
+
+  //! Return the dot product of the unknown parts of a and b
+  ctype dot_(const std::vector<GlobalCoordinate>& a,
+             const std::vector<GlobalCoordinate>& b) const {
+    ctype sum = 0.0;
+    for (std::size_t i = 0; i < size_; ++i) sum += a[i] * b[i];
+    return sum;
+  }
+
+  //! Compute z = D^-1 r
+  void precondition_(const std::vector<GlobalCoordinate>& d,
+                     const std::vector<GlobalCoordinate>& r,
+                     std::vector<GlobalCoordinate>& z) const {
+    for (std::size_t i = 0; i < size_; ++i)
+      for (int a = 0; a < dim; ++a) z[i][a] = d[i][a] * r[i][a];
+  }
+
+  //! Return the position of the local id i in the cell
+  static int corner_(const Cell& cell, std::size_t i) {
+    for (int k = 0; k < dim; ++k)
+      if (cell[k] == i) return k;
+    return dim;
+  }
+
+  static constexpr ctype factorial_() { return dim == 2 ? 2.0 : 6.0; }
+
+  static constexpr ctype infinity_ = std::numeric_limits<ctype>::infinity();
+
+  const Grid& grid_;
+  Distance<Grid> distance_;
+  bool band_ = false;
+  Operator operator_ = Operator::laplace;
+  ctype nu_ = 0.3;
+  ctype stiffening_ = 0.0;
+  ctype tolerance_ = 1e-8;
+  int maxIterations_ = 1000;
+  int iterations_ = 0;
+  ctype residual_ = 0.0;
+
+  //! The unknowns have the local ids 0,...,size_-1
+  std::size_t size_ = 0;
+  std::vector<int> localId_;
+  std::vector<typename Grid::Vertex> vertices_;
+  std::vector<std::size_t> indices_;
+  std::vector<GlobalCoordinate> u_;
+
+  //! The cells of the stars of the unknowns
+  std::vector<int> cellId_;
+  std::vector<Cell> cells_;
+  std::vector<Gradients> gradients_;
+  std::vector<ctype> weights_;
+  std::vector<std::size_t> starOffsets_;
+  std::vector<std::uint32_t> starCells_;
+};
+
+}  // end namespace Dune
+
+#endif
@@ -0,0 +1,259 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+/*!
+ * \file
+ * \ingroup MMesh Remeshing
+ * \brief   Class for computing quality metrics of all cells.
+ */
+
+#ifndef DUNE_MMESH_REMESHING_QUALITY_HH
+#define DUNE_MMESH_REMESHING_QUALITY_HH
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <dune/common/fvector.hh>
+#include <dune/common/math.hh>
+#include <dune/grid/common/partitionset.hh>
+#include <dune/mmesh/misc/parallelfor.hh>
+
+namespace Dune {
+
+/*!
+ * \ingroup MMesh Remeshing
+ * \brief   Class for computing quality metrics of all cells.
+ *
+ * The metrics are computed in a single parallel sweep over the cell corners
+ * and stored as arrays indexed by the leaf index of the cells. If the
+ * geometry cache of the grid is valid, its corners are used, otherwise the
+ * corners are gathered once per update. The metrics are
+ *  - the volume,
+ *  - the ratio of the longest to the shortest edge,
+ *  - the ratio R / (dim r) of circumradius R and inradius r, which is 1 for
+ *    the equilateral simplex and grows as the cell degenerates,
+ *  - the minimal and maximal planar (2d) or dihedral (3d) angle in degrees.
+ */
+template <class Grid>
+class MMeshQuality {
+  static constexpr int dim = Grid::dimension;
+  using ctype = typename Grid::ctype;
+  using GlobalCoordinate = FieldVector<ctype, dim>;
+  using Corners = std::array<GlobalCoordinate, dim + 1>;
+
+ public:
+  //! Summary statistics of a metric
+  struct Statistics {
+    ctype minimum = 0.0;
+    ctype maximum = 0.0;
+    ctype mean = 0.0;
+  };
+
+  //! Constructor with grid reference
+  explicit MMeshQuality(const Grid& grid) : grid_(grid) {}
+
+  //! Compute the metrics of all cells
+  void update() {
+    const auto& cache = grid_.geometryCache();
+    if (cache.valid()) {
+      resize_(cache.size());
+      MMeshImpl::parallelFor(size_, [this, &cache](std::size_t i) {
+        compute_(i, cache.corners(i));
+      });
+      return;
+    }
+
+    const auto& indexSet = grid_.leafIndexSet();
+    resize_(indexSet.size(0));
+    corners_.resize(size_);
+    for (const auto& element :
+         elements(grid_.leafGridView(), Partitions::all)) {
+      const auto& geo = element.geometry();
+      Corners& x = corners_[indexSet.index(element)];
+      for (int k = 0; k < dim + 1; ++k) x[k] = geo.corner(k);
+    }
+
+    MMeshImpl::parallelFor(
+        size_, [this](std::size_t i) { compute_(i, corners_[i]); });
+  }
+
+  //! Return the number of cells
+  std::size_t size() const { return size_; }
+
+  //! Return the volumes
+  const std::vector<ctype>& volume() const { return volume_; }
+
+  //! Return the ratios of the longest to the shortest edge
+  const std::vector<ctype>& edgeRatio() const { return edgeRatio_; }
+
+  //! Return the ratios of circumradius to dim times the inradius
+  const std::vector<ctype>& radiusRatio() const { return radiusRatio_; }
+
+  //! Return the minimal angles in degrees
+  const std::vector<ctype>& minAngle() const { return minAngle_; }
+
+  //! Return the maximal angles in degrees
+  const std::vector<ctype>& maxAngle() const { return maxAngle_; }
+
+  //! Return minimum, maximum and mean of a metric
+  static Statistics statistics(const std::vector<ctype>& values) {
+    Statistics s;
+    if (values.empty()) return s;
+
+    s.minimum = std::numeric_limits<ctype>::max();
+    s.maximum = std::numeric_limits<ctype>::lowest();
+    ctype sum = 0.0;
+    for (const ctype v : values) {
+      s.minimum = std::min(s.minimum, v);
+      s.maximum = std::max(s.maximum, v);
+      sum += v;
+    }
+    s.mean = sum / values.size();
+    return s;
+  }
+
+  /*!
+   * \brief Return the histogram of a metric
+   *
+   * \param values  The values of a metric
+   * \param bins    The number of equidistant bins in [lower, upper]
+   * \param lower   The lower bound, smaller values are counted in the first bin
+   * \param upper   The upper bound, larger values are counted in the last bin
+   */
+  static std::vector<std::size_t> histogram(const std::vector<ctype>& values,
+                                            std::size_t bins, ctype lower,
+                                            ctype upper) {
+    std::vector<std::size_t> counts(bins, 0);
+    if (bins == 0) return counts;
+
+    const ctype width = (upper - lower) / bins;
+    for (const ctype v : values) {
+      const ctype bin = std::floor((v - lower) / width);
+      if (bin < 0)
+        counts.front()++;
+      else if (!(bin < bins))
+        counts.back()++;
+      else
+        counts[std::size_t(bin)]++;
+    }
+    return counts;
+  }
+
+ private:
+  void resize_(std::size_t size) {
+    size_ = size;
+    volume_.resize(size_);
+    edgeRatio_.resize(size_);
+    radiusRatio_.resize(size_);
+    minAngle_.resize(size_);
+    maxAngle_.resize(size_);
+  }
+
+  //! Return the angle between u and v in degrees
+  static ctype angle_(const GlobalCoordinate& u, const GlobalCoordinate& v) {
+    const ctype cos = (u * v) / (u.two_norm() * v.two_norm());
+    return std::acos(std::clamp(cos, ctype(-1.0), ctype(1.0))) * 180.0 /
+           StandardMathematicalConstants<ctype>::pi();
+  }
+
+  static GlobalCoordinate cross_(const GlobalCoordinate& a,
+                                 const GlobalCoordinate& b) {
+    return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+            a[0] * b[1] - a[1] * b[0]};
+  }
+
+  //! Compute the metrics of cell i
+  void compute_(std::size_t i, const Corners& x) {
+    ctype minE = std::numeric_limits<ctype>::max();
+    ctype maxE = 0.0;
+    for (int k = 0; k < dim + 1; ++k)
+      for (int l = k + 1; l < dim + 1; ++l) {
+        const ctype len = (x[k] - x[l]).two_norm();
+        minE = std::min(minE, len);
+        maxE = std::max(maxE, len);
+      }
+    edgeRatio_[i] = maxE / minE;
+
+    ctype volume, circumradius, inradius;
+    ctype minAngle = 180.0, maxAngle = 0.0;
+
+    if constexpr (dim == 2) {
+      const GlobalCoordinate a = x[1] - x[0];
+      const GlobalCoordinate b = x[2] - x[0];
+      volume = 0.5 * std::abs(a[0] * b[1] - a[1] * b[0]);
+
+      const ctype ab = a.two_norm(), ac = b.two_norm();
+      const ctype bc = (x[2] - x[1]).two_norm();
+      circumradius = ab * ac * bc / (4.0 * volume);
+      inradius = 2.0 * volume / (ab + ac + bc);
+
+      for (int k = 0; k < 3; ++k) {
+        const ctype alpha =
+            angle_(x[(k + 1) % 3] - x[k], x[(k + 2) % 3] - x[k]);
+        minAngle = std::min(minAngle, alpha);
+        maxAngle = std::max(maxAngle, alpha);
+      }
+    } else {
+      const GlobalCoordinate a = x[1] - x[0];
+      const GlobalCoordinate b = x[2] - x[0];
+      const GlobalCoordinate c = x[3] - x[0];
+      const GlobalCoordinate bc = cross_(b, c);
+      const GlobalCoordinate ca = cross_(c, a);
+      const GlobalCoordinate ab = cross_(a, b);
+      const ctype det = a * bc;
+      volume = std::abs(det) / 6.0;
+
+      GlobalCoordinate center = bc;
+      center *= a.two_norm2();
+      center.axpy(b.two_norm2(), ca);
+      center.axpy(c.two_norm2(), ab);
+      circumradius = center.two_norm() / std::abs(2.0 * det);
+
+      // outer normals of the facets opposite to vertex k
+      std::array<GlobalCoordinate, 4> n;
+      ctype area = 0.0;
+      for (int k = 0; k < 4; ++k) {
+        const GlobalCoordinate& p = x[(k + 1) % 4];
+        n[k] = cross_(x[(k + 2) % 4] - p, x[(k + 3) % 4] - p);
+        if (n[k] * (x[k] - p) > 0.0) n[k] *= -1.0;
+        area += 0.5 * n[k].two_norm();
+      }
+      inradius = 3.0 * volume / area;
+
+      // the dihedral angle at the edge (k, l) is enclosed by the facets
+      // opposite to the other two vertices
+      for (int k = 0; k < 4; ++k)
+        for (int l = k + 1; l < 4; ++l) {
+          int f[2], j = 0;
+          for (int m = 0; m < 4; ++m)
+            if (m != k && m != l) f[j++] = m;
+
+          const ctype alpha = 180.0 - angle_(n[f[0]], n[f[1]]);
+          minAngle = std::min(minAngle, alpha);
+          maxAngle = std::max(maxAngle, alpha);
+        }
+    }
+
+    volume_[i] = volume;
+    radiusRatio_[i] = (volume > 0.0) ? circumradius / (dim * inradius)
+                                     : std::numeric_limits<ctype>::infinity();
+    minAngle_[i] = minAngle;
+    maxAngle_[i] = maxAngle;
+  }
+
+  const Grid& grid_;
+  std::size_t size_ = 0;
+  std::vector<Corners> corners_;
+
+  std::vector<ctype> volume_;
+  std::vector<ctype> edgeRatio_;
+  std::vector<ctype> radiusRatio_;
+  std::vector<ctype> minAngle_;
+  std::vector<ctype> maxAngle_;
+};
+
+}  // end namespace Dune
+
+#endif
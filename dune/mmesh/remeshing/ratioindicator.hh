@@ -13,6 +13,7 @@
 #include <dune/common/exceptions.hh>
 #include <dune/grid/common/partitionset.hh>
 #include <dune/mmesh/remeshing/distance.hh>
+#include <array>
 #include <memory>
 
 namespace Dune {
@@ -87,7 +88,15 @@ class RatioIndicator {
     }
 
     factor_ = maxh / minh;
+
+    // keep the settings of the distance
+    const ctype bandWidth = distance_.bandWidth();
+    const bool incremental = distance_.incremental();
+    const bool isSigned = distance_.isSigned();
     distance_ = DistanceType(grid);
+    distance_.setBandWidth(bandWidth);
+    distance_.setIncremental(incremental);
+    distance_.setSigned(isSigned);
   };
 
   //! Update the distances of all vertices
@@ -105,7 +114,7 @@ class RatioIndicator {
    */
   template <class Element>
   int operator()(const Element& element) const {
-    static constexpr int edgeCodim = Element::dimension - 1;
+    static constexpr int mydim = Element::mydimension;
 
     int refine = 0;
     int coarse = 0;
@@ -120,37 +129,52 @@ class RatioIndicator {
     const ctype minH = (1. - l) * minH_ + l * factor_ * minH_;
     const ctype maxH = (1. - l) * maxH_ + l * factor_ * maxH_;
 
-    for (std::size_t i = 0; i < element.subEntities(edgeCodim); ++i) {
-      const auto& edge = element.template subEntity<edgeCodim>(i);
-      const ctype len = edge.geometry().volume();
+    // the edges of a simplex connect all pairs of corners
+    const auto& geo = element.geometry();
+    std::array<GlobalCoordinate, mydim + 1> corners;
+    for (int i = 0; i < mydim + 1; ++i) corners[i] = geo.corner(i);
+
+    for (int i = 0; i < mydim + 1; ++i)
+      for (int j = i + 1; j < mydim + 1; ++j) {
+        const ctype len = (corners[i] - corners[j]).two_norm();
 
-      if (len < minH) coarse++;
+        if (len < minH) coarse++;
 
-      if (len > maxH) refine++;
+        if (len > maxH) refine++;
 
-      minE = std::min(minE, len);
-      maxE = std::max(maxE, len);
+        minE = std::min(minE, len);
+        maxE = std::max(maxE, len);
 
-      sumE += len;
-    }
+        sumE += len;
+      }
 
     // edge ratio criterion
     const ctype edgeRatio = maxE / minE;
     if (edgeRatio > edgeRatio_) coarse++;
 
-    // radius ratio criterion
-    const auto& geo = element.geometry();
-    const ctype innerRadius = dim * geo.volume() / sumE;
+    // radius ratio criterion, for tetrahedra the inradius is 3 V / A with
+    // the surface area A such that the regular tetrahedron has ratio 1
+    ctype innerRadius = dim * geo.volume() / sumE;
+    if constexpr (mydim == 3) {
+      ctype area = 0.0;
+      for (int i = 0; i < 4; ++i) {
+        const GlobalCoordinate a = corners[(i + 2) % 4] - corners[(i + 1) % 4];
+        const GlobalCoordinate b = corners[(i + 3) % 4] - corners[(i + 1) % 4];
+        const GlobalCoordinate n{a[1] * b[2] - a[2] * b[1],
+                                 a[2] * b[0] - a[0] * b[2],
+                                 a[0] * b[1] - a[1] * b[0]};
+        area += 0.5 * n.two_norm();
+      }
+      innerRadius = 3.0 * geo.volume() / area;
+    }
     const ctype outerRadius =
-        (geo.impl().circumcenter() - geo.corner(0)).two_norm();
+        (geo.impl().circumcenter() - corners[0]).two_norm();
     const ctype radiusRatio = outerRadius / (innerRadius * dim);
 
     if (radiusRatio > radiusRatio_) coarse++;
 
     // priority on coarse
-    if (coarse > 0)
-      if (dim != 3)  // disable coarsening in 3d until it is implemented
-        return -1;
+    if (coarse > 0) return -1;
 
     // then refine
     if (refine > 0) return 1;
@@ -187,6 +211,31 @@ class RatioIndicator {
     return distance_;
   }
 
+  //! Enable the incremental update of the distance
+  void setIncrementalDistance(bool incremental = true) {
+    distance_.setIncremental(incremental);
+  }
+
+  //! Set the band width of the distance, see Distance::setBandWidth()
+  void setDistanceBandWidth(ctype bandWidth) {
+    distance_.setBandWidth(bandWidth);
+  }
+
+  //! Enable the signed distance and phases, see Distance::setSigned()
+  void setSignedDistance(bool isSigned = true) {
+    distance_.setSigned(isSigned);
+  }
+
+  //! Register a moved vertex for the incremental distance update, see
+  //! Distance::changed()
+  template <class Vertex>
+  void vertexChanged(const Vertex& vertex, ctype shift = 0.0) {
+    distance_.changed(vertex, shift);
+  }
+
+  //! Notify the distance that the vertex indices change
+  void indicesChanged() { distance_.indicesChanged(); }
+
  private:
   const ctype edgeRatio_;
   const ctype K_;
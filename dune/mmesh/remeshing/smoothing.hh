@@ -0,0 +1,334 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+/*!
+ * \file
+ * \ingroup MMesh Remeshing
+ * \brief   Class for smoothing the bulk vertices around the interface.
+ */
+
+#ifndef DUNE_MMESH_REMESHING_SMOOTHING_HH
+#define DUNE_MMESH_REMESHING_SMOOTHING_HH
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <dune/common/fvector.hh>
+#include <dune/mmesh/misc/parallelfor.hh>
+#include <dune/mmesh/remeshing/distance.hh>
+
+namespace Dune {
+
+/*!
+ * \ingroup MMesh Remeshing
+ * \brief   Class for smoothing the bulk vertices around the interface.
+ *
+ * The vertices closer to the interface than the band width are moved
+ * towards the volume weighted mean of the circumcenters (optimal Delaunay
+ * triangulation, ODT) or of the centroids (centroidal patch triangulation,
+ * CPT) of their incident cells. A move is only accepted if the minimal mean
+ * ratio of the incident cells increases, otherwise the step is halved.
+ *
+ * Interface vertices stay fixed. Boundary vertices stay fixed as well,
+ * except for vertices with boundaryFlag 0 on a straight boundary in 2d which
+ * slide along the boundary.
+ *
+ * The vertices are colored such that no two vertices of a color share a
+ * cell. The colors are relaxed one after another and the vertices of a
+ * color in parallel. Finally, the grid is updated by moveVertices().
+ */
+template <class Grid>
+class MMeshSmoothing {
+  static constexpr int dim = Grid::dimension;
+  using ctype = typename Grid::ctype;
+  using GlobalCoordinate = FieldVector<ctype, dim>;
+  using Vertex = typename Grid::Vertex;
+  using RefinementStrategy = typename Grid::RefinementStrategy;
+  using Cell = std::array<std::uint32_t, dim + 1>;
+
+ public:
+  //! The target of the vertex relaxation
+  enum class Method { odt, cpt };
+
+  //! Constructor with grid reference
+  explicit MMeshSmoothing(Grid& grid) : grid_(grid), distance_(grid) {}
+
+  //! Set the width of the band around the interface that is smoothed
+  void setBandWidth(ctype bandWidth) { distance_.setBandWidth(bandWidth); }
+
+  //! Return the band width
+  ctype bandWidth() const { return distance_.bandWidth(); }
+
+  //! Set the target of the vertex relaxation
+  void setMethod(Method method) { method_ = method; }
+
+  //! Return the target of the vertex relaxation
+  Method method() const { return method_; }
+
+  //! Set the number of sweeps over all colors
+  void setIterations(int iterations) { iterations_ = iterations; }
+
+  //! Return the number of sweeps over all colors
+  int iterations() const { return iterations_; }
+
+  //! Smooth the vertices in the band and return the number of moved vertices
+  std::size_t smooth() {
+    gather_();
+    color_();
+
+    moved_.assign(size_, 0);
+    for (int iteration = 0; iteration < iterations_; ++iteration)
+      for (std::size_t c = 0; c + 1 < colorOffsets_.size(); ++c)
+        MMeshImpl::parallelFor(
+            colorOffsets_[c + 1] - colorOffsets_[c], [this, c](std::size_t j) {
+              const std::size_t i = colorVertices_[colorOffsets_[c] + j];
+              if (relax_(i)) moved_[i] = 1;
+            });
+
+    std::size_t count = 0;
+    std::vector<GlobalCoordinate> shifts(grid_.leafIndexSet().size(dim),
+                                         GlobalCoordinate(0.0));
+    for (std::size_t i = 0; i < size_; ++i)
+      if (moved_[i]) {
+        shifts[indices_[i]] = x_[i] - initial_[i];
+        ++count;
+      }
+
+    if (count > 0) grid_.moveVertices(shifts);
+    return count;
+  }
+
+ private:
+  //! Gather the vertices in the band, their stars and the neighbors
+  void gather_() {
+    distance_.update();
+    const auto& indexSet = grid_.leafIndexSet();
+    localId_.assign(indexSet.size(dim), -1);
+    vertices_.clear();
+    indices_.clear();
+    x_.clear();
+    tangents_.clear();
+
+    for (const auto& vertex : vertices(grid_.leafGridView())) {
+      if (vertex.impl().isInterface()) continue;
+      if (!(distance_(vertex) < distance_.bandWidth())) continue;
+
+      GlobalCoordinate tangent(0.0);
+      if (RefinementStrategy::atBoundary(vertex)) {
+        if constexpr (dim == 2) {
+          if (!slidingTangent_(vertex, tangent)) continue;
+        } else
+          continue;
+      }
+
+      localId_[indexSet.index(vertex)] = indices_.size();
+      vertices_.push_back(vertex);
+      indices_.push_back(indexSet.index(vertex));
+      x_.push_back(vertex.geometry().center());
+      tangents_.push_back(tangent);
+    }
+    size_ = indices_.size();
+
+    // the stars, the neighbors obtain local ids after the band vertices
+    starOffsets_.assign(1, 0);
+    cells_.clear();
+    for (std::size_t i = 0; i < size_; ++i) {
+      for (const auto& element : incidentElements(vertices_[i])) {
+        Cell cell;
+        for (int k = 0; k < dim + 1; ++k) {
+          const auto& v = element.template subEntity<dim>(k);
+          const std::size_t index = indexSet.index(v);
+          if (localId_[index] < 0) {
+            localId_[index] = indices_.size();
+            indices_.push_back(index);
+            x_.push_back(v.geometry().center());
+          }
+          cell[k] = localId_[index];
+        }
+        cells_.push_back(cell);
+      }
+      starOffsets_.push_back(cells_.size());
+    }
+    initial_ = x_;
+  }
+
+  //! Greedy coloring of the band vertices
+  void color_() {
+    colors_.assign(size_, -1);
+    int numColors = 0;
+    std::vector<bool> used;
+    for (std::size_t i = 0; i < size_; ++i) {
+      used.assign(numColors + 1, false);
+      for (std::size_t s = starOffsets_[i]; s < starOffsets_[i + 1]; ++s)
+        for (const auto j : cells_[s])
+          if (j < size_ && colors_[j] >= 0) used[colors_[j]] = true;
+
+      int color = 0;
+      while (used[color]) ++color;
+      colors_[i] = color;
+      numColors = std::max(numColors, color + 1);
+    }
+
+    colorOffsets_.assign(numColors + 1, 0);
+    for (const int color : colors_) colorOffsets_[color + 1]++;
+    for (int c = 0; c < numColors; ++c)
+      colorOffsets_[c + 1] += colorOffsets_[c];
+
+    colorVertices_.resize(size_);
+    std::vector<std::size_t> next(colorOffsets_.begin(), colorOffsets_.end());
+    for (std::size_t i = 0; i < size_; ++i)
+      colorVertices_[next[colors_[i]]++] = i;
+  }
+
+  //! Move the band vertex i if the quality of its star increases
+  bool relax_(std::size_t i) {
+    GlobalCoordinate target(0.0);
+    ctype volume = 0.0;
+    for (std::size_t s = starOffsets_[i]; s < starOffsets_[i + 1]; ++s) {
+      const auto p = corners_(s);
+      const ctype v = std::abs(signedVolume_(p));
+      if (method_ == Method::odt)
+        target.axpy(v, circumcenter_(p));
+      else
+        target.axpy(v, centroid_(p));
+      volume += v;
+    }
+    if (volume <= 0.0) return false;
+    target /= volume;
+
+    GlobalCoordinate step = target - x_[i];
+    if (tangents_[i] != GlobalCoordinate(0.0)) {
+      const ctype length = step * tangents_[i];
+      step = tangents_[i];
+      step *= length;
+    }
+
+    const GlobalCoordinate x = x_[i];
+    const ctype quality = minQuality_(i);
+    for (int k = 0; k < 4; ++k, step *= 0.5) {
+      x_[i] = x + step;
+      if (minQuality_(i) > quality) return true;
+    }
+
+    x_[i] = x;
+    return false;
+  }
+
+  //! Return the minimal mean ratio of the star of i, -1 if a cell inverts
+  ctype minQuality_(std::size_t i) const {
+    ctype quality = 1.0;
+    for (std::size_t s = starOffsets_[i]; s < starOffsets_[i + 1]; ++s) {
+      const auto p = corners_(s);
+      const ctype volume = signedVolume_(p);
+      if (volume <= 0.0) return -1.0;
+
+      ctype sum = 0.0;
+      for (int k = 0; k < dim + 1; ++k)
+        for (int l = k + 1; l < dim + 1; ++l) sum += (p[k] - p[l]).two_norm2();
+
+      // the mean ratio is 1 for the equilateral simplex
+      if constexpr (dim == 2)
+        quality = std::min(quality, 4.0 * std::sqrt(3.0) * volume / sum);
+      else
+        quality =
+            std::min(quality, 12.0 * std::cbrt(9.0 * volume * volume) / sum);
+    }
+    return quality;
+  }
+
+  //! Return the corners of the star cell s
+  std::array<GlobalCoordinate, dim + 1> corners_(std::size_t s) const {
+    std::array<GlobalCoordinate, dim + 1> p;
+    for (int k = 0; k < dim + 1; ++k) p[k] = x_[cells_[s][k]];
+    return p;
+  }
+
+  static ctype signedVolume_(const std::array<GlobalCoordinate, dim + 1>& p) {
+    const GlobalCoordinate a = p[1] - p[0];
+    const GlobalCoordinate b = p[2] - p[0];
+    if constexpr (dim == 2)
+      return 0.5 * (a[0] * b[1] - a[1] * b[0]);
+    else
+      return a * cross_(b, p[3] - p[0]) / 6.0;
+  }
+
+  static GlobalCoordinate centroid_(
+      const std::array<GlobalCoordinate, dim + 1>& p) {
+    GlobalCoordinate c(0.0);
+    for (const auto& x : p) c += x;
+    c /= dim + 1;
+    return c;
+  }
+
+  static GlobalCoordinate circumcenter_(
+      const std::array<GlobalCoordinate, dim + 1>& p) {
+    const GlobalCoordinate a = p[1] - p[0];
+    const GlobalCoordinate b = p[2] - p[0];
+    GlobalCoordinate center;
+    if constexpr (dim == 2) {
+      const ctype d = 2.0 * (a[0] * b[1] - a[1] * b[0]);
+      center = {(b[1] * a.two_norm2() - a[1] * b.two_norm2()) / d,
+                (a[0] * b.two_norm2() - b[0] * a.two_norm2()) / d};
+    } else {
+      const GlobalCoordinate c = p[3] - p[0];
+      center = cross_(b, c);
+      center *= a.two_norm2();
+      center.axpy(b.two_norm2(), cross_(c, a));
+      center.axpy(c.two_norm2(), cross_(a, b));
+      center /= 2.0 * (a * cross_(b, c));
+    }
+    return center + p[0];
+  }
+
+  static GlobalCoordinate cross_(const GlobalCoordinate& a,
+                                 const GlobalCoordinate& b) {
+    return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+            a[0] * b[1] - a[1] * b[0]};
+  }
+
+  //! Compute the tangent of a boundary vertex that can slide, 2d only
+  bool slidingTangent_(const Vertex& vertex, GlobalCoordinate& tangent) const {
+    if (RefinementStrategy::boundaryFlag(vertex) != 0) return false;
+
+    std::array<GlobalCoordinate, 2> neighbors;
+    int count = 0;
+    for (const auto& v : incidentVertices(vertex))
+      if (RefinementStrategy::atBoundary(v)) {
+        if (count == 2) return false;
+        neighbors[count++] = v.geometry().center();
+      }
+    if (count != 2) return false;
+
+    tangent = neighbors[1] - neighbors[0];
+    tangent /= tangent.two_norm();
+    return true;
+  }
+
+  Grid& grid_;
+  Distance<Grid> distance_;
+  Method method_ = Method::odt;
+  int iterations_ = 3;
+
+  //! The band vertices have the local ids 0,...,size_-1
+  std::size_t size_ = 0;
+  std::vector<int> localId_;
+  std::vector<Vertex> vertices_;
+  std::vector<std::size_t> indices_;
+  std::vector<GlobalCoordinate> x_, initial_, tangents_;
+  std::vector<std::uint8_t> moved_;
+
+  //! The stars of the band vertices
+  std::vector<std::size_t> starOffsets_;
+  std::vector<Cell> cells_;
+
+  //! The band vertices sorted by color
+  std::vector<int> colors_;
+  std::vector<std::size_t> colorOffsets_;
+  std::vector<std::size_t> colorVertices_;
+};
+
+}  // end namespace Dune
+
+#endif
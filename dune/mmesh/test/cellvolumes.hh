@@ -0,0 +1,60 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_MMESH_TEST_CELLVOLUMES_HH
+#define DUNE_MMESH_TEST_CELLVOLUMES_HH
+
+#include <algorithm>
+#include <array>
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <limits>
+
+namespace Dune {
+
+//! Return the signed volume (times dim!) of a simplex
+template <class Corners>
+double signedVolume(const Corners& p) {
+  static constexpr int dim = Corners::value_type::dimension;
+  FieldMatrix<double, dim, dim> jacobian;
+  for (int i = 0; i < dim; ++i) jacobian[i] = p[i + 1] - p[0];
+  return jacobian.determinant();
+}
+
+//! Return the number of cells that are not positively oriented
+template <class Grid>
+int invertedCells(const Grid& grid) {
+  static constexpr int dim = Grid::dimension;
+  int count = 0;
+  for (const auto& element : elements(grid.leafGridView())) {
+    std::array<FieldVector<double, dim>, dim + 1> p;
+    for (int i = 0; i < dim + 1; ++i) p[i] = element.geometry().corner(i);
+    if (signedVolume(p) <= 0.0) ++count;
+  }
+  return count;
+}
+
+//! Return the minimal signed volume (times dim!) of all cells
+template <class Grid>
+double minSignedVolume(const Grid& grid) {
+  static constexpr int dim = Grid::dimension;
+  double minVolume = std::numeric_limits<double>::max();
+  for (const auto& element : elements(grid.leafGridView())) {
+    std::array<FieldVector<double, dim>, dim + 1> p;
+    for (int i = 0; i < dim + 1; ++i) p[i] = element.geometry().corner(i);
+    minVolume = std::min(minVolume, signedVolume(p));
+  }
+  return minVolume;
+}
+
+//! Return the volume of all cells
+template <class Grid>
+double volume(const Grid& grid) {
+  double volume = 0.0;
+  for (const auto& element : elements(grid.leafGridView()))
+    volume += element.geometry().volume();
+  return volume;
+}
+
+}  // end namespace Dune
+
+#endif
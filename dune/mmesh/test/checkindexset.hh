@@ -0,0 +1,53 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+#ifndef DUNE_MMESH_TEST_CHECKINDEXSET_HH
+#define DUNE_MMESH_TEST_CHECKINDEXSET_HH
+
+#include <dune/common/exceptions.hh>
+#include <dune/common/hybridutilities.hh>
+#include <dune/geometry/dimension.hh>
+#include <utility>
+#include <vector>
+
+namespace Dune {
+
+//! Check that the indices of every codim are a permutation of 0,...,size-1
+//! and consistent with the sub-indices of the elements, and that the
+//! adaptation markers have been reset
+template <class Grid>
+void checkIndexSet(const Grid& grid) {
+  static constexpr int dim = Grid::dimension;
+  const auto& gv = grid.leafGridView();
+  const auto& indexSet = gv.indexSet();
+
+  Hybrid::forEach(std::make_index_sequence<dim + 1>{}, [&](auto codim) {
+    std::vector<bool> found(indexSet.size(codim), false);
+    for (const auto& entity : entities(gv, Codim<codim>{})) {
+      const std::size_t index = indexSet.index(entity);
+      if (index >= found.size() || found[index])
+        DUNE_THROW(InvalidStateException,
+                   "Codim " << codim << " index " << index << " is invalid!");
+      found[index] = true;
+    }
+
+    for (bool f : found)
+      if (!f)
+        DUNE_THROW(InvalidStateException,
+                   "Codim " << codim << " indices are not consecutive!");
+
+    for (const auto& element : elements(gv))
+      for (std::size_t i = 0; i < element.subEntities(codim); ++i)
+        if (indexSet.subIndex(element, i, codim) !=
+            indexSet.index(element.template subEntity<codim>(i)))
+          DUNE_THROW(InvalidStateException,
+                     "Codim " << codim << " subIndex and index differ!");
+  });
+
+  for (const auto& element : elements(gv))
+    if (element.isNew() || element.mightVanish() || grid.getMark(element) != 0)
+      DUNE_THROW(InvalidStateException, "Markers have not been reset!");
+}
+
+}  // end namespace Dune
+
+#endif
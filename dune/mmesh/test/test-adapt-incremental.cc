@@ -0,0 +1,122 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/common/timer.hh>
+#include <dune/mmesh/mmesh.hh>
+#include "checkindexset.hh"
+#include <iostream>
+
+using namespace Dune;
+
+//! Refine around a moving point and remove vertices behind it, returns the
+//! time needed for adapt() and postAdapt()
+template <class Grid>
+double adaptCycle(Grid& grid, int cycle) {
+  static constexpr int dim = Grid::dimension;
+  using GlobalCoordinate = FieldVector<double, dim>;
+
+  GlobalCoordinate center(0.5);
+  center[0] = 0.2 + 0.05 * cycle;
+  const double radius = 0.05;
+
+  for (const auto& element : elements(grid.leafGridView())) {
+    auto d = element.geometry().center();
+    d -= center;
+    if (d.two_norm() < radius) grid.mark(1, element);
+  }
+
+  // removal is only supported in 2d
+  if constexpr (dim == 2) {
+    std::size_t count = 0;
+    for (const auto& vertex : vertices(grid.leafGridView())) {
+      if (vertex.impl().insertionLevel() == 0) continue;
+
+      const auto x = vertex.geometry().center();
+      auto d = x;
+      d -= center;
+
+      bool inside = true;
+      for (int i = 0; i < dim; ++i) inside &= (x[i] > 0.05 && x[i] < 0.95);
+
+      if (inside && d.two_norm() > 2 * radius && count++ < 20)
+        grid.removeVertex(vertex);
+    }
+  }
+
+  Dune::Timer timer;
+  grid.preAdapt();
+  grid.adapt();
+  double elapsed = timer.elapsed();
+
+  // every new element is mapped to a non-empty component
+  for (const auto& element : elements(grid.leafGridView()))
+    if (element.isNew() && grid.getConnectedComponent(element).size() == 0)
+      DUNE_THROW(InvalidStateException, "Connected component is empty!");
+
+  timer.reset();
+  grid.postAdapt();
+  return elapsed + timer.elapsed();
+}
+
+template <class Grid>
+void runBenchmark(unsigned int cells, int cycles) {
+  static constexpr int dim = Grid::dimension;
+  using GridFactory = MMeshStructuredGridFactory<Grid>;
+
+  FieldVector<double, dim> lowerLeft(0.0), upperRight(1.0);
+  std::array<unsigned int, dim> elements;
+  elements.fill(cells);
+
+  GridFactory fullFactory(lowerLeft, upperRight, elements);
+  Grid& full = *fullFactory.grid();
+
+  GridFactory incrementalFactory(lowerLeft, upperRight, elements);
+  Grid& incremental = *incrementalFactory.grid();
+  incremental.setIncrementalAdaptation();
+
+  double tFull = 0.0, tIncremental = 0.0;
+  for (int cycle = 0; cycle < cycles; ++cycle) {
+    tFull += adaptCycle(full, cycle);
+    tIncremental += adaptCycle(incremental, cycle);
+
+    checkIndexSet(incremental);
+
+    for (int codim = 0; codim <= dim; ++codim)
+      if (full.size(codim) != incremental.size(codim))
+        DUNE_THROW(InvalidStateException,
+                   "Incremental grid differs from full grid in codim "
+                       << codim << "!");
+  }
+
+  std::cout << "dim " << dim << ": " << full.size(0) << " elements, "
+            << "adapt full " << tFull / cycles << "s, incremental "
+            << tIncremental / cycles << "s per cycle (speedup "
+            << tFull / tIncremental << ")" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- Incremental adaptation test --" << std::endl;
+
+    const int cycles = (argc > 1) ? std::stoi(argv[1]) : 10;
+    runBenchmark<MovingMesh<2>>(100, cycles);
+    runBenchmark<MovingMesh<3>>(16, cycles);
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
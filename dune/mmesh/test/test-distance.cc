@@ -7,8 +7,10 @@
 #include <dune/common/exceptions.hh>  // We use exceptions
 #include <dune/common/float_cmp.hh>
 #include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/common/timer.hh>
 #include <dune/mmesh/mmesh.hh>
 #include <iostream>
+#include <random>
 
 using namespace Dune;
 
@@ -37,6 +39,279 @@ void writeAndCheckDistance(const Grid& grid, double tol = 1e-8) {
   }
 }
 
+//! Compare the bounding volume hierarchy with a brute force search
+template <int dim>
+void checkHierarchy(std::size_t numPrimitives, std::size_t numPoints) {
+  using BVH = MMeshBoundingVolumeHierarchy<dim>;
+  using GlobalCoordinate = typename BVH::GlobalCoordinate;
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  auto randomPoint = [&]() {
+    GlobalCoordinate x;
+    for (int d = 0; d < dim; ++d) x[d] = uniform(gen);
+    return x;
+  };
+
+  // small primitives scattered in the unit cube
+  std::vector<typename BVH::Primitive> primitives(numPrimitives);
+  for (auto& p : primitives) {
+    const GlobalCoordinate center = randomPoint();
+    for (auto& corner : p) {
+      corner = randomPoint();
+      corner -= 0.5;
+      corner *= 0.05;
+      corner += center;
+    }
+  }
+
+  std::vector<GlobalCoordinate> points(numPoints);
+  for (auto& x : points) x = randomPoint();
+
+  BVH bvh;
+  bvh.build(primitives);
+
+  Dune::Timer timer;
+  std::vector<double> fast(numPoints);
+  for (std::size_t i = 0; i < numPoints; ++i) fast[i] = bvh.distance(points[i]);
+  const double tFast = timer.elapsed();
+
+  timer.reset();
+  for (std::size_t i = 0; i < numPoints; ++i) {
+    double dist = 1e100;
+    for (const auto& p : primitives) {
+      double d;
+      if constexpr (dim == 2)
+        d = MMeshImpl::squaredDistanceToSegment(points[i], p[0], p[1]);
+      else
+        d = MMeshImpl::squaredDistanceToTriangle(points[i], p[0], p[1], p[2]);
+      dist = std::min(dist, d);
+    }
+    if (std::abs(std::sqrt(dist) - fast[i]) > 1e-12)
+      DUNE_THROW(InvalidStateException, "Hierarchy distance is wrong!");
+  }
+  const double tBrute = timer.elapsed();
+
+  std::cout << "dim " << dim << ": " << numPoints << " points, "
+            << numPrimitives << " primitives, hierarchy " << tFast
+            << "s, brute force " << tBrute << "s" << std::endl;
+
+  // the closest point of a triangle is found in each region
+  if constexpr (dim == 3) {
+    const GlobalCoordinate a{0, 0, 0}, b{1, 0, 0}, c{0, 1, 0};
+    auto check = [&](GlobalCoordinate x, double expected) {
+      const double d = MMeshImpl::squaredDistanceToTriangle(x, a, b, c);
+      if (std::abs(d - expected) > 1e-14)
+        DUNE_THROW(InvalidStateException, "Triangle distance is wrong!");
+    };
+    check({0.2, 0.2, 1.0}, 1.0);    // face
+    check({-1.0, -1.0, 0.0}, 2.0);  // vertex a
+    check({2.0, 0.0, 1.0}, 2.0);    // vertex b
+    check({0.5, -1.0, 0.0}, 1.0);   // edge ab
+    check({-1.0, 0.5, 0.0}, 1.0);   // edge ac
+    check({1.0, 1.0, 0.0}, 0.5);    // edge bc
+  }
+}
+
+//! Compare the distance with a full update
+template <class Grid>
+void compareWithFullUpdate(const Grid& grid, const Distance<Grid>& distance) {
+  Distance<Grid> full(grid);
+  full.setBandWidth(distance.bandWidth());
+  full.update();
+
+  for (const auto& vertex : vertices(grid.leafGridView()))
+    if (std::abs(distance(vertex) - full(vertex)) > 1e-12)
+      DUNE_THROW(InvalidStateException,
+                 "Incremental distance of vertex at "
+                     << vertex.geometry().center() << " is "
+                     << distance(vertex) << " instead of " << full(vertex));
+}
+
+//! Check the incremental update after interface movement and adaptation
+template <class Grid>
+void checkIncremental(Grid& grid) {
+  static constexpr int dim = Grid::dimension;
+  using GlobalCoordinate = FieldVector<double, dim>;
+
+  auto& indicator = grid.indicator();
+  indicator.setIncrementalDistance();
+  indicator.update();
+
+  // move a part of the interface
+  const auto& igv = grid.interfaceGrid().leafGridView();
+  std::vector<GlobalCoordinate> shifts(igv.size(dim - 1));
+  for (const auto& vertex : vertices(igv)) {
+    const auto x = vertex.geometry().center();
+    auto& shift = shifts[igv.indexSet().index(vertex)];
+    shift = 0.0;
+    shift[1] = 0.01 * std::max(0.0, 1.0 - std::abs(x[0] - 0.5) / 0.2);
+  }
+
+  Dune::Timer timer;
+  grid.moveInterface(shifts);
+  indicator.update();
+  std::cout << "incremental update after movement " << timer.elapsed() << "s"
+            << std::endl;
+  compareWithFullUpdate(grid, indicator.distance());
+
+  // move a small part far, the distance also increases away from it
+  for (const auto& vertex : vertices(igv)) {
+    const auto x = vertex.geometry().center();
+    auto& shift = shifts[igv.indexSet().index(vertex)];
+    shift = 0.0;
+    shift[1] = -0.03 * std::max(0.0, 1.0 - std::abs(x[0] - 0.3) / 0.15);
+  }
+
+  grid.moveInterface(shifts);
+  indicator.update();
+  compareWithFullUpdate(grid, indicator.distance());
+
+  // adapt the grid, the stored indicator values coincide with the marks
+  grid.markElements();
+  for (const auto& element : elements(grid.leafGridView())) {
+    const int value = grid.indicatorValue(element);
+    if (value != grid.getMark(element) || value != indicator(element))
+      DUNE_THROW(InvalidStateException, "Indicator value is not stored!");
+  }
+  grid.adapt();
+  grid.postAdapt();
+
+  timer.reset();
+  indicator.update();
+  std::cout << "incremental update after adaptation " << timer.elapsed()
+            << "s" << std::endl;
+  compareWithFullUpdate(grid, indicator.distance());
+}
+
+//! Check the distance in a band around the interface
+template <class Grid>
+void checkBand(const Grid& grid, double bandWidth) {
+  Distance<Grid> distance(grid);
+  distance.setBandWidth(bandWidth);
+  distance.update();
+
+  for (const auto& vertex : vertices(grid.leafGridView())) {
+    const double exactDistance = std::abs(vertex.geometry().center()[1] - 0.5);
+    const double expected = std::min(exactDistance, bandWidth);
+
+    if (std::abs(distance(vertex) - expected) > 1e-8)
+      DUNE_THROW(InvalidStateException,
+                 "Band distance of vertex at " << vertex.geometry().center()
+                                               << " is " << distance(vertex));
+  }
+}
+
+//! Check the signed distance and the phases of the ellipse grid
+template <class Grid>
+void checkSigned(Grid& grid) {
+  static constexpr int dim = Grid::dimension;
+  using GlobalCoordinate = FieldVector<double, dim>;
+
+  Distance<Grid> distance(grid);
+  distance.setSigned();
+  distance.update();
+
+  // level set of the ellipse with half axes 0.3 and 0.15
+  auto level = [](const GlobalCoordinate& x) {
+    return x[0] * x[0] / 0.09 + x[1] * x[1] / 0.0225;
+  };
+
+  // skip points close to the discrete interface
+  auto inside = [&](const GlobalCoordinate& x, bool expected) {
+    const double l = level(x);
+    if (l > 0.9 && l < 1.1) return;
+    if ((l < 1.0) != expected)
+      DUNE_THROW(InvalidStateException, "Wrong phase at " << x << "!");
+  };
+
+  for (const auto& vertex : vertices(grid.leafGridView())) {
+    const double signedDistance = distance.signedDistance(vertex);
+    if (std::abs(std::abs(signedDistance) - distance(vertex)) > 1e-14)
+      DUNE_THROW(InvalidStateException, "Signed distance is inconsistent!");
+    inside(vertex.geometry().center(), signedDistance < 0.0);
+  }
+
+  for (const auto& element : elements(grid.leafGridView()))
+    inside(element.geometry().center(), distance.phase(element) == 1);
+
+  if (!distance.classifiable())
+    DUNE_THROW(InvalidStateException, "Closed interface is not classifiable!");
+
+  // the normals point outwards
+  for (const auto& ielement : elements(grid.interfaceGrid().leafGridView())) {
+    const auto x = ielement.geometry().center();
+    const GlobalCoordinate gradient{x[0] / 0.09, x[1] / 0.0225};
+    if (distance.normal(ielement) * gradient <= 0.0)
+      DUNE_THROW(InvalidStateException, "Normal at " << x << " points inside!");
+  }
+}
+
+//! Check the incremental classification after interface movement and
+//! adaptation
+template <class Grid>
+void checkSignedIncremental(Grid& grid) {
+  static constexpr int dim = Grid::dimension;
+  using GlobalCoordinate = FieldVector<double, dim>;
+
+  auto& indicator = grid.indicator();
+  indicator.setIncrementalDistance();
+  indicator.setSignedDistance();
+  indicator.update();
+
+  auto compare = [&grid](const auto& distance) {
+    Distance<Grid> full(grid);
+    full.setSigned();
+    full.update();
+
+    for (const auto& element : elements(grid.leafGridView()))
+      if (distance.phase(element) != full.phase(element))
+        DUNE_THROW(InvalidStateException,
+                   "Incremental phase of element at "
+                       << element.geometry().center() << " is wrong!");
+
+    for (const auto& vertex : vertices(grid.leafGridView()))
+      if (std::abs(distance.signedDistance(vertex) -
+                   full.signedDistance(vertex)) > 1e-12)
+        DUNE_THROW(InvalidStateException,
+                   "Incremental signed distance of vertex at "
+                       << vertex.geometry().center() << " is wrong!");
+
+    if (!distance.classifiable())
+      DUNE_THROW(InvalidStateException, "Incremental phases are inconsistent!");
+  };
+
+  // inflate the ellipse
+  const auto& igv = grid.interfaceGrid().leafGridView();
+  std::vector<GlobalCoordinate> shifts(igv.size(dim - 1));
+  for (const auto& vertex : vertices(igv)) {
+    auto& shift = shifts[igv.indexSet().index(vertex)];
+    shift = vertex.geometry().center();
+    shift *= 0.02;
+  }
+
+  grid.moveInterface(shifts);
+  indicator.update();
+  compare(indicator.distance());
+
+  grid.markElements();
+  grid.adapt();
+  grid.postAdapt();
+  indicator.update();
+  compare(indicator.distance());
+}
+
+//! An interface ending inside the domain cannot be classified
+template <class Grid>
+void checkUnclassifiable(const Grid& grid) {
+  Distance<Grid> distance(grid);
+  distance.setSigned();
+  distance.update();
+
+  if (distance.classifiable())
+    DUNE_THROW(InvalidStateException, "Open interface is classifiable!");
+}
+
 /** Test-template main program. Instantiate a single expression
  * template and evaluate it on a simple grid.
  */
@@ -44,6 +319,9 @@ int main(int argc, char* argv[]) {
   MPIHelper::instance(argc, argv);
   std::cout << "-- Distance test --" << std::endl;
 
+  checkHierarchy<2>(2000, 10000);
+  checkHierarchy<3>(2000, 10000);
+
   using Grid2D = Dune::MovingMesh<2>;
   using GridFactory2D = Dune::GmshGridFactory<Grid2D>;
 
@@ -55,12 +333,22 @@ int main(int argc, char* argv[]) {
   GridFactory2D gridFactory2d("grids/line2d.msh");
   Grid2D& grid2d = *gridFactory2d.grid();
   writeAndCheckDistance(grid2d);
+  checkBand(grid2d, 0.25);
+  checkIncremental(grid2d);
+
+  // Check the signed distance of a closed interface
+  GridFactory2D gridFactory2dellipse("grids/ellipse2d.msh");
+  checkSigned(*gridFactory2dellipse.grid());
+  checkSignedIncremental(*gridFactory2dellipse.grid());
+
+  GridFactory2D gridFactory2djunction("grids/junction2d.msh");
+  checkUnclassifiable(*gridFactory2djunction.grid());
 
   using Grid3D = Dune::MovingMesh<3>;
   using GridFactory3D = Dune::GmshGridFactory<Grid3D>;
   GridFactory3D gridFactory3d("grids/flat3d.msh");
   Grid3D& grid3d = *gridFactory3d.grid();
-  writeAndCheckDistance(grid3d, 0.05);
+  writeAndCheckDistance(grid3d);
 
   return EXIT_SUCCESS;
 }
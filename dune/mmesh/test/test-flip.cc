@@ -0,0 +1,391 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/mmesh/mmesh.hh>
+#include "cellvolumes.hh"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <set>
+#include <vector>
+
+using namespace Dune;
+
+template <class Grid>
+void runTest(unsigned int cells) {
+  static constexpr int dim = Grid::dimension;
+  using GridFactory = MMeshStructuredGridFactory<Grid>;
+  using GlobalCoordinate = FieldVector<double, dim>;
+  using IdType = typename Grid::GlobalIdSet::IdType;
+
+  FieldVector<double, dim> lowerLeft(0.0), upperRight(1.0);
+  std::array<unsigned int, dim> numCells;
+  numCells.fill(cells);
+
+  GridFactory gridFactory(lowerLeft, upperRight, numCells);
+  Grid& grid = *gridFactory.grid();
+  const auto& gridView = grid.leafGridView();
+
+  // find a vertex that can be moved across the opposite facet of an incident
+  // cell such that only this cell inverts and the flip of the facet is
+  // feasible before and after the movement
+  std::vector<GlobalCoordinate> shifts;
+  IdType id;
+  GlobalCoordinate shift;
+
+  auto findCandidate = [&]() {
+    for (const auto& vertex : vertices(gridView)) {
+      if (Grid::RefinementStrategy::atBoundary(vertex)) continue;
+      const auto x = vertex.geometry().center();
+
+      for (const auto& element : incidentElements(vertex)) {
+        std::array<GlobalCoordinate, dim + 1> p;
+        int k = 0;
+        for (int i = 0; i < dim + 1; ++i) {
+          p[i] = element.geometry().corner(i);
+          if ((p[i] - x).two_norm() < 1e-12) k = i;
+        }
+
+        for (const auto& is : intersections(gridView, element)) {
+          if (!is.neighbor()) continue;
+
+          // the facet opposite to the vertex
+          bool opposite = true;
+          for (int i = 0; i < dim; ++i)
+            opposite &= (is.geometry().corner(i) - x).two_norm() > 1e-12;
+          if (!opposite) continue;
+
+          // the vertex of the neighbor opposite to the facet
+          GlobalCoordinate d;
+          const auto& geo = is.outside().geometry();
+          for (int i = 0; i < dim + 1; ++i)
+            if (std::find(p.begin(), p.end(), geo.corner(i)) == p.end())
+              d = geo.corner(i);
+
+          bool feasible = true;
+          for (int j = 0; j < dim + 1; ++j)
+            if (j != k) {
+              auto q = p;
+              q[j] = d;
+              feasible &= signedVolume(q) > 0.0;
+            }
+          if (!feasible) continue;
+
+          // move the vertex slightly behind the facet
+          GlobalCoordinate target = is.geometry().center();
+          target.axpy(0.1, d - target);
+
+          shifts.assign(grid.leafIndexSet().size(dim), GlobalCoordinate(0.0));
+          shifts[grid.leafIndexSet().index(vertex)] = target - x;
+          grid.moveVertices(shifts);
+          const int inverted = invertedCells(grid);
+          shifts[grid.leafIndexSet().index(vertex)] = x - target;
+          grid.moveVertices(shifts);
+
+          if (inverted == 1) {
+            id = grid.globalIdSet().id(vertex);
+            shift = target - x;
+            return true;
+          }
+        }
+      }
+    }
+    return false;
+  };
+
+  if (!findCandidate())
+    DUNE_THROW(InvalidStateException, "No candidate for a flip found!");
+
+  // the shifts are indexed by the leaf index set
+  auto setShifts = [&]() {
+    shifts.assign(grid.leafIndexSet().size(dim), GlobalCoordinate(0.0));
+    for (const auto& vertex : vertices(gridView))
+      if (grid.globalIdSet().id(vertex) == id)
+        shifts[grid.leafIndexSet().index(vertex)] = shift;
+  };
+
+  const int numVertices = grid.size(dim);
+  const int numElements = grid.size(0);
+
+  setShifts();
+  if (!grid.ensureVertexMovement(shifts))
+    DUNE_THROW(InvalidStateException, "No cell has been repaired!");
+
+  grid.adapt();
+  grid.postAdapt();
+  std::cout << "dim " << dim << ": " << numElements << " -> " << grid.size(0)
+            << " elements" << std::endl;
+
+  // a flip keeps the vertices, the 2-3 flip adds one cell
+  if (grid.size(dim) != numVertices)
+    DUNE_THROW(InvalidStateException, "The vertices changed!");
+  if (invertedCells(grid) > 0)
+    DUNE_THROW(InvalidStateException, "The flip inverted a cell!");
+
+  setShifts();
+  grid.moveVertices(shifts);
+  if (invertedCells(grid) > 0)
+    DUNE_THROW(InvalidStateException, "A cell is inverted after moving!");
+
+  // the flipped grid is still a valid triangulation
+  if (std::abs(volume(grid) - 1.0) > 1e-12)
+    DUNE_THROW(InvalidStateException, "Volumes do not sum up to 1!");
+}
+
+//! Move the apex a of a bipyramid with apices a, b and the given ring, such
+//! that the cell (a, b, r1, r2) inverts. All other facets and edges of this
+//! cell are at the convex hull or cannot be flipped, only an edge flip of
+//! (a, b) repairs it: the 3-2 flip for a ring of three and the 4-4 flip for a
+//! ring of four vertices.
+void testEdgeFlip(const std::vector<FieldVector<double, 3>>& ring,
+                  const FieldVector<double, 3>& shift) {
+  using Grid = MovingMesh<3>;
+  using GlobalCoordinate = FieldVector<double, 3>;
+  using IdType = Grid::GlobalIdSet::IdType;
+
+  // with a height below the radius of the ring the Delaunay triangulation
+  // contains the edge (a, b)
+  MMeshImplicitGridFactory<Grid> gridFactory;
+  gridFactory.insertVertex({0.0, 0.0, -0.5});
+  gridFactory.insertVertex({0.0, 0.0, 0.5});
+  for (const auto& r : ring) gridFactory.insertVertex(r);
+  auto gridPtr = gridFactory.createGrid();
+  Grid& grid = *gridPtr;
+  const auto& gridView = grid.leafGridView();
+
+  IdType id;
+  for (const auto& vertex : vertices(gridView))
+    if (vertex.geometry().center()[2] < -0.25)
+      id = grid.globalIdSet().id(vertex);
+
+  std::vector<GlobalCoordinate> shifts;
+  auto setShifts = [&]() {
+    shifts.assign(grid.leafIndexSet().size(3), GlobalCoordinate(0.0));
+    for (const auto& vertex : vertices(gridView))
+      if (grid.globalIdSet().id(vertex) == id)
+        shifts[grid.leafIndexSet().index(vertex)] = shift;
+  };
+
+  const int numVertices = grid.size(3);
+  const int numElements = grid.size(0);
+  const double bulkVolume = volume(grid);
+  if (numElements != static_cast<int>(ring.size()))
+    DUNE_THROW(InvalidStateException, "The edge (a, b) does not exist!");
+
+  setShifts();
+  if (!grid.ensureVertexMovement(shifts))
+    DUNE_THROW(InvalidStateException, "No cell has been repaired!");
+
+  grid.adapt();
+  grid.postAdapt();
+  std::cout << "edge flip: " << numElements << " -> " << grid.size(0)
+            << " elements" << std::endl;
+
+  // the 3-2 flip removes one cell, the 4-4 flip keeps the number of cells
+  if (grid.size(3) != numVertices)
+    DUNE_THROW(InvalidStateException, "The vertices changed!");
+  const int expected = ring.size() == 3 ? 2 : 4;
+  if (grid.size(0) != expected)
+    DUNE_THROW(InvalidStateException, "The edge (a, b) has not been flipped!");
+  if (invertedCells(grid) > 0)
+    DUNE_THROW(InvalidStateException, "The flip inverted a cell!");
+
+  setShifts();
+  grid.moveVertices(shifts);
+  if (invertedCells(grid) > 0)
+    DUNE_THROW(InvalidStateException, "A cell is inverted after moving!");
+
+  // the apex only moves parallel to the ring
+  if (std::abs(volume(grid) - bulkVolume) > 1e-12)
+    DUNE_THROW(InvalidStateException, "The volume changed!");
+}
+
+//! Move an interface vertex behind the opposite facet of an incident cell,
+//! such that a flip repairs the cell, and check that the interface survives
+template <class Grid>
+void testInterface(Grid& grid) {
+  static constexpr int dim = Grid::dimension;
+  using GlobalCoordinate = FieldVector<double, dim>;
+  using IdType = typename Grid::GlobalIdSet::IdType;
+
+  const auto& gridView = grid.leafGridView();
+  const auto& igrid = grid.interfaceGrid();
+  const auto& iindexSet = igrid.leafIndexSet();
+
+  // the interface segments by the ids of their vertices
+  auto interfaceSegments = [&]() {
+    std::set<std::vector<IdType>> segments;
+    for (const auto& segment : elements(igrid.leafGridView())) {
+      std::vector<IdType> ids;
+      for (std::size_t i = 0; i < segment.subEntities(dim - 1); ++i) {
+        const auto& v = segment.template subEntity<dim - 1>(i);
+        const auto vertex = grid.entity(v.impl().hostEntity());
+        ids.push_back(grid.globalIdSet().id(vertex));
+      }
+      std::sort(ids.begin(), ids.end());
+      segments.insert(ids);
+    }
+    return segments;
+  };
+
+  // the number of interface facets and edges seen from the bulk grid
+  auto interfaceEntities = [&]() {
+    int count = 0;
+    for (const auto& element : elements(gridView))
+      for (const auto& is : intersections(gridView, element))
+        count += grid.isInterface(is);
+    if constexpr (dim == 3)
+      for (const auto& edge : edges(gridView)) count += grid.isInterface(edge);
+    return count;
+  };
+
+  std::vector<GlobalCoordinate> shifts;
+  IdType id;
+  GlobalCoordinate shift;
+
+  auto findCandidate = [&]() {
+    for (const auto& vertex : vertices(gridView)) {
+      if (!grid.isInterface(vertex)) continue;
+      const auto x = vertex.geometry().center();
+      const auto ivertex = igrid.entity(vertex.impl().hostEntity());
+
+      for (const auto& element : incidentElements(vertex)) {
+        std::array<GlobalCoordinate, dim + 1> p;
+        int k = 0;
+        for (int i = 0; i < dim + 1; ++i) {
+          p[i] = element.geometry().corner(i);
+          if ((p[i] - x).two_norm() < 1e-12) k = i;
+        }
+
+        for (const auto& is : intersections(gridView, element)) {
+          if (!is.neighbor() || grid.isInterface(is)) continue;
+
+          // the facet opposite to the vertex
+          bool opposite = true;
+          for (int i = 0; i < dim; ++i)
+            opposite &= (is.geometry().corner(i) - x).two_norm() > 1e-12;
+          if (!opposite) continue;
+
+          // the vertex of the neighbor opposite to the facet
+          GlobalCoordinate d;
+          const auto& geo = is.outside().geometry();
+          for (int i = 0; i < dim + 1; ++i)
+            if (std::find(p.begin(), p.end(), geo.corner(i)) == p.end())
+              d = geo.corner(i);
+
+          // move the vertex slightly behind the facet
+          GlobalCoordinate target = is.geometry().center();
+          target.axpy(0.1, d - target);
+
+          // the flip of the facet is feasible before and after the movement
+          bool feasible = true;
+          for (int j = 0; j < dim + 1; ++j)
+            if (j != k) {
+              auto q = p;
+              q[j] = d;
+              feasible &= signedVolume(q) > 0.0;
+              q[k] = target;
+              feasible &= signedVolume(q) > 0.0;
+            }
+          if (!feasible) continue;
+
+          shifts.assign(iindexSet.size(dim - 1), GlobalCoordinate(0.0));
+          shifts[iindexSet.index(ivertex)] = target - x;
+          grid.moveInterface(shifts);
+          const int inverted = invertedCells(grid);
+          shifts[iindexSet.index(ivertex)] = x - target;
+          grid.moveInterface(shifts);
+
+          if (inverted == 1) {
+            id = grid.globalIdSet().id(vertex);
+            shift = target - x;
+            return true;
+          }
+        }
+      }
+    }
+    return false;
+  };
+
+  if (!findCandidate())
+    DUNE_THROW(InvalidStateException, "No candidate for a flip found!");
+
+  // the shifts are indexed by the interface leaf index set
+  auto setShifts = [&]() {
+    shifts.assign(iindexSet.size(dim - 1), GlobalCoordinate(0.0));
+    for (const auto& ivertex : vertices(igrid.leafGridView()))
+      if (grid.globalIdSet().id(grid.entity(ivertex.impl().hostEntity())) ==
+          id)
+        shifts[iindexSet.index(ivertex)] = shift;
+  };
+
+  const int numVertices = grid.size(dim);
+  const auto segments = interfaceSegments();
+  const int numInterfaceEntities = interfaceEntities();
+  const double bulkVolume = volume(grid);
+
+  setShifts();
+  if (!grid.ensureInterfaceMovement(shifts))
+    DUNE_THROW(InvalidStateException, "No cell has been repaired!");
+
+  grid.adapt();
+  grid.postAdapt();
+  std::cout << "interface dim " << dim << ": " << segments.size() << " -> "
+            << igrid.size(0) << " segments" << std::endl;
+
+  // the cell is repaired by a flip, the interface is not touched
+  if (grid.size(dim) != numVertices)
+    DUNE_THROW(InvalidStateException, "The vertices changed!");
+  if (interfaceSegments() != segments)
+    DUNE_THROW(InvalidStateException, "The interface segments changed!");
+  if (interfaceEntities() != numInterfaceEntities)
+    DUNE_THROW(InvalidStateException, "The interface entities changed!");
+  if (invertedCells(grid) > 0)
+    DUNE_THROW(InvalidStateException, "The flip inverted a cell!");
+
+  setShifts();
+  grid.moveInterface(shifts);
+  if (invertedCells(grid) > 0)
+    DUNE_THROW(InvalidStateException, "A cell is inverted after moving!");
+  if (std::abs(volume(grid) - bulkVolume) > 1e-12)
+    DUNE_THROW(InvalidStateException, "The bulk volume changed!");
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- Flip test --" << std::endl;
+
+    runTest<MovingMesh<2>>(4);
+    runTest<MovingMesh<3>>(4);
+
+    // the 3-2 and the 4-4 flip of the edge between the apices
+    const double s = std::sqrt(3.0) / 2.0;
+    testEdgeFlip({{1.0, 0.0, 0.0}, {-0.5, s, 0.0}, {-0.5, -s, 0.0}},
+                 {-1.2, 0.0, 0.0});
+    testEdgeFlip(
+        {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, -1.0, 0.0}},
+        {-1.2, 1.2, 0.0});
+
+    GmshGridFactory<MovingMesh<2>> gridFactory2d("grids/ellipse2d.msh");
+    testInterface(*gridFactory2d.grid());
+    GmshGridFactory<MovingMesh<3>> gridFactory3d("grids/sphere3d.msh");
+    testInterface(*gridFactory3d.grid());
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
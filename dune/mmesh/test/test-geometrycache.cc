@@ -0,0 +1,159 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/common/timer.hh>
+#include <dune/mmesh/mmesh.hh>
+#include <algorithm>
+#include <iostream>
+
+using namespace Dune;
+
+//! Sum up geometric quantities as an assembly loop would do
+template <class GridView>
+double assemble(const GridView& gv) {
+  double sum = 0.0;
+  for (const auto& element : elements(gv)) {
+    const auto geo = element.geometry();
+    sum += geo.volume();
+    sum += geo.jacobianInverseTransposed(geo.local(geo.center()))[0][0];
+
+    for (const auto& is : intersections(gv, element)) {
+      const auto n = is.centerUnitOuterNormal();
+      sum += n[0] + is.integrationOuterNormal(is.geometry().local(
+                        is.geometry().center()))[1];
+    }
+  }
+  return sum;
+}
+
+//! Compare the cached geometries with the CGAL based ones
+template <class Grid>
+void compare(const Grid& grid) {
+  static constexpr int dim = Grid::dimension;
+  const auto& gv = grid.leafGridView();
+  const auto& cache = grid.geometryCache();
+  const auto& indexSet = grid.leafIndexSet();
+  using GeometryImpl =
+      typename Grid::template Codim<0>::Geometry::Implementation;
+
+  if (!cache.valid()) DUNE_THROW(InvalidStateException, "Cache is invalid!");
+
+  for (const auto& element : elements(gv)) {
+    const auto i = indexSet.index(element);
+    const GeometryImpl geo(element.impl().hostEntity());
+
+    for (int k = 0; k < dim + 1; ++k) {
+      auto d = cache.corner(i, k);
+      d -= geo.corner(k);
+      if (d.two_norm() > 1e-12)
+        DUNE_THROW(InvalidStateException, "Cached corner differs!");
+    }
+
+    if (std::abs(cache.volume(i) - geo.volume()) > 1e-12)
+      DUNE_THROW(InvalidStateException, "Cached volume differs!");
+
+    auto jit = cache.jacobianInverseTransposed(i);
+    jit -= geo.jacobianInverseTransposed(geo.center());
+    if (jit.frobenius_norm() > 1e-8)
+      DUNE_THROW(InvalidStateException, "Cached Jacobian inverse differs!");
+
+    for (const auto& is : intersections(gv, element)) {
+      const int j = is.indexInInside();
+      const auto n = cache.integrationOuterNormal(i, j);
+
+      // reference: corners of the uncached element geometry
+      const auto igeo = is.geometry();
+      for (int k = 0; k < dim; ++k) {
+        auto d = igeo.corner(k);
+        d -= geo.corner(MMeshImpl::refSubVertex<dim>(j, 1, k));
+        if (d.two_norm() > 1e-12)
+          DUNE_THROW(InvalidStateException, "Cached facet corner differs!");
+      }
+
+      auto x = igeo.center();
+      x -= geo.center();
+      if (n * x <= 0.0)
+        DUNE_THROW(InvalidStateException, "Cached normal is not outward!");
+    }
+  }
+}
+
+template <class Grid>
+void runBenchmark(unsigned int cells, int repetitions) {
+  static constexpr int dim = Grid::dimension;
+  using GridFactory = MMeshStructuredGridFactory<Grid>;
+
+  FieldVector<double, dim> lowerLeft(0.0), upperRight(1.0);
+  std::array<unsigned int, dim> elements;
+  elements.fill(cells);
+
+  GridFactory gridFactory(lowerLeft, upperRight, elements);
+  Grid& grid = *gridFactory.grid();
+  const auto& gv = grid.leafGridView();
+
+  Dune::Timer timer;
+  double sumHost = 0.0;
+  for (int r = 0; r < repetitions; ++r) sumHost += assemble(gv);
+  const double tHost = timer.elapsed();
+
+  grid.setGeometryCaching();
+  compare(grid);
+
+  timer.reset();
+  double sumCache = 0.0;
+  for (int r = 0; r < repetitions; ++r) sumCache += assemble(gv);
+  const double tCache = timer.elapsed();
+
+  if (std::abs(sumHost - sumCache) > 1e-8 * std::abs(sumHost))
+    DUNE_THROW(InvalidStateException, "Cached assembly differs!");
+
+  // moving the vertices has to refill the cache
+  std::vector<FieldVector<double, dim>> shifts(gv.size(dim));
+  for (auto& s : shifts) s = 1e-3;
+  grid.moveVertices(shifts);
+  compare(grid);
+
+  // moving a single interior vertex only refreshes its star
+  for (auto& s : shifts) s = 0.0;
+  for (const auto& vertex : vertices(gv)) {
+    const auto x = vertex.geometry().center();
+    if (x.infinity_norm() > 0.75 ||
+        *std::min_element(x.begin(), x.end()) < 0.25)
+      continue;
+    shifts[gv.indexSet().index(vertex)] = 0.1 / cells;
+    break;
+  }
+  grid.moveVertices(shifts);
+  compare(grid);
+
+  std::cout << "dim " << dim << ": " << grid.size(0) << " elements, "
+            << "host " << tHost << "s, cache " << tCache << "s (speedup "
+            << tHost / tCache << ")" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- Geometry cache test --" << std::endl;
+
+    const int repetitions = (argc > 1) ? std::stoi(argv[1]) : 5;
+    runBenchmark<MovingMesh<2>>(64, repetitions);
+    runBenchmark<MovingMesh<3>>(12, repetitions);
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
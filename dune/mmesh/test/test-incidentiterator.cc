@@ -0,0 +1,146 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/common/timer.hh>
+#include <dune/mmesh/mmesh.hh>
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+
+using namespace Dune;
+
+//! Return the sorted indices of a range of entities
+template <class IndexSet, class Range>
+std::vector<std::size_t> indices(const IndexSet& indexSet, const Range& range) {
+  std::vector<std::size_t> result;
+  for (const auto& entity : range) result.push_back(indexSet.index(entity));
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+//! Compare the incident iterators with a scan of the elements
+template <class Grid>
+void checkIncident(const Grid& grid) {
+  static constexpr int dim = Grid::dimension;
+  const auto& gv = grid.leafGridView();
+  const auto& indexSet = gv.indexSet();
+
+  std::vector<std::vector<std::size_t>> elementsOf(indexSet.size(dim));
+  std::vector<std::vector<std::size_t>> facetsOf(indexSet.size(dim));
+  std::vector<std::vector<std::size_t>> verticesOf(indexSet.size(dim));
+
+  for (const auto& element : elements(gv))
+    for (std::size_t k = 0; k < dim + 1; ++k) {
+      const auto v = indexSet.subIndex(element, k, dim);
+      elementsOf[v].push_back(indexSet.index(element));
+
+      for (std::size_t l = 0; l < dim + 1; ++l)
+        if (l != k)
+          verticesOf[v].push_back(indexSet.subIndex(element, l, dim));
+    }
+
+  for (const auto& facet : facets(gv))
+    for (std::size_t k = 0; k < dim; ++k)
+      facetsOf[indexSet.index(facet.impl().template subEntity<dim>(k))]
+          .push_back(indexSet.index(facet));
+
+  for (auto* list : {&elementsOf, &facetsOf, &verticesOf})
+    for (auto& l : *list) {
+      std::sort(l.begin(), l.end());
+      l.erase(std::unique(l.begin(), l.end()), l.end());
+    }
+
+  for (const auto& vertex : vertices(gv)) {
+    const auto v = indexSet.index(vertex);
+
+    if (indices(indexSet, incidentElements(vertex)) != elementsOf[v])
+      DUNE_THROW(InvalidStateException, "Incident elements differ!");
+
+    if (indices(indexSet, incidentFacets(vertex)) != facetsOf[v])
+      DUNE_THROW(InvalidStateException, "Incident facets differ!");
+
+    if (indices(indexSet, incidentVertices(vertex)) != verticesOf[v])
+      DUNE_THROW(InvalidStateException, "Incident vertices differ!");
+  }
+
+  // the elements incident to an edge are the ones shared by its vertices
+  if constexpr (dim == 3)
+    for (const auto& edge : edges(gv)) {
+      const auto& v0 = edge.impl().template subEntity<dim>(0);
+      const auto& v1 = edge.impl().template subEntity<dim>(1);
+      const auto& e0 = elementsOf[indexSet.index(v0)];
+      const auto& e1 = elementsOf[indexSet.index(v1)];
+      std::vector<std::size_t> shared;
+      std::set_intersection(e0.begin(), e0.end(), e1.begin(), e1.end(),
+                            std::back_inserter(shared));
+
+      if (indices(indexSet, incidentElements(edge)) != shared)
+        DUNE_THROW(InvalidStateException, "Edge incident elements differ!");
+    }
+}
+
+//! Visit all vertex stars as a vertex patch loop would do
+template <class GridView>
+double visitStars(const GridView& gv) {
+  double sum = 0.0;
+  for (const auto& vertex : vertices(gv)) {
+    for (const auto& element : incidentElements(vertex))
+      sum += element.impl().hostEntity()->info().index;
+    for (const auto& facet : incidentFacets(vertex))
+      sum += facet.impl().hostEntity().second;
+    for (const auto& v : incidentVertices(vertex))
+      sum += v.impl().hostEntity()->info().index;
+  }
+  return sum;
+}
+
+template <class Grid>
+void runBenchmark(unsigned int cells, int repetitions) {
+  static constexpr int dim = Grid::dimension;
+  using GridFactory = MMeshStructuredGridFactory<Grid>;
+
+  FieldVector<double, dim> lowerLeft(0.0), upperRight(1.0);
+  std::array<unsigned int, dim> elements;
+  elements.fill(cells);
+
+  GridFactory gridFactory(lowerLeft, upperRight, elements);
+  Grid& grid = *gridFactory.grid();
+  const auto& gv = grid.leafGridView();
+
+  checkIncident(grid);
+
+  Dune::Timer timer;
+  double sum = 0.0;
+  for (int r = 0; r < repetitions; ++r) sum += visitStars(gv);
+  const double t = timer.elapsed();
+
+  std::cout << "dim " << dim << ": " << grid.size(dim) << " vertex stars in "
+            << t / repetitions << "s (checksum " << sum << ")" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- Incident iterator test --" << std::endl;
+
+    const int repetitions = (argc > 1) ? std::stoi(argv[1]) : 10;
+    runBenchmark<MovingMesh<2>>(64, repetitions);
+    runBenchmark<MovingMesh<3>>(12, repetitions);
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,105 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/common/timer.hh>
+#include <dune/mmesh/mmesh.hh>
+#include <iostream>
+#include <unordered_map>
+
+using namespace Dune;
+
+//! Compare the per-cell sub-entity indices with an id based index map and
+//! measure the time needed to obtain all sub-indices of all elements.
+template <class Grid>
+void benchmarkSubIndices(const Grid& grid, int repetitions) {
+  static constexpr int dim = Grid::dimension;
+  const auto& gv = grid.leafGridView();
+  const auto& indexSet = grid.leafIndexSet();
+  const auto& idSet = grid.globalIdSet();
+
+  Hybrid::forEach(std::make_index_sequence<dim - 1>{}, [&](auto c) {
+    static constexpr int codim = c + 1;
+
+    // id based index map as used before
+    std::unordered_map<typename Grid::GlobalIdSet::IdType, std::size_t> map;
+    for (const auto& entity : entities(gv, Codim<codim>{}, Partitions::all))
+      map[idSet.id(entity)] = indexSet.index(entity);
+
+    if (map.size() != indexSet.size(codim))
+      DUNE_THROW(InvalidStateException,
+                 "Codim " << codim << " index is not unique!");
+
+    Dune::Timer timer;
+    std::size_t sumMap = 0;
+    for (int r = 0; r < repetitions; ++r)
+      for (const auto& element : elements(gv, Partitions::all))
+        for (std::size_t i = 0; i < element.subEntities(codim); ++i)
+          sumMap += map.at(idSet.subId(element, i, codim));
+    const double tMap = timer.elapsed();
+
+    timer.reset();
+    std::size_t sumCell = 0;
+    for (int r = 0; r < repetitions; ++r)
+      for (const auto& element : elements(gv, Partitions::all))
+        for (std::size_t i = 0; i < element.subEntities(codim); ++i)
+          sumCell += indexSet.subIndex(element, i, codim);
+    const double tCell = timer.elapsed();
+
+    if (sumMap != sumCell)
+      DUNE_THROW(InvalidStateException,
+                 "Codim " << codim << " sub-indices do not match id map!");
+
+    // index of the sub entity itself has to agree with the sub index
+    for (const auto& element : elements(gv, Partitions::all))
+      for (std::size_t i = 0; i < element.subEntities(codim); ++i)
+        if (indexSet.index(element.template subEntity<codim>(i)) !=
+            indexSet.subIndex(element, i, codim))
+          DUNE_THROW(InvalidStateException,
+                     "Codim " << codim << " index and subIndex differ!");
+
+    std::cout << "dim " << dim << " codim " << codim << ": " << map.size()
+              << " entities, id map " << tMap << "s, per-cell " << tCell
+              << "s (speedup " << tMap / tCell << ")" << std::endl;
+  });
+}
+
+template <class Grid>
+void runBenchmark(int repetitions) {
+  static constexpr int dim = Grid::dimension;
+  using GridFactory = MMeshStructuredGridFactory<Grid>;
+
+  FieldVector<double, dim> lowerLeft(0.0), upperRight(1.0);
+  std::array<unsigned int, dim> elements;
+  elements.fill(dim == 2 ? 64 : 12);
+
+  GridFactory gridFactory(lowerLeft, upperRight, elements);
+  Grid& grid = *gridFactory.grid();
+  benchmarkSubIndices(grid, repetitions);
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- Index set benchmark --" << std::endl;
+
+    const int repetitions = (argc > 1) ? std::stoi(argv[1]) : 5;
+    runBenchmark<MovingMesh<2>>(repetitions);
+    runBenchmark<MovingMesh<3>>(repetitions);
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
@@ -9,6 +9,7 @@
 #include <dune/grid/common/mcmgmapper.hh>
 #include <dune/grid/io/file/vtk/vtkwriter.hh>
 #include <dune/mmesh/mmesh.hh>
+#include <algorithm>
 #include <iostream>
 
 using namespace Dune;
@@ -58,6 +59,45 @@ int main(int argc, char* argv[]) {
                                          << expected << " expected!"
                                          << std::endl);
 
+    // The interface grid is traversed by the interface registry, compare it
+    // with a scan of the bulk grid
+    const auto& igridView = grid.interfaceGrid().leafGridView();
+
+    int numberOfInterfaceElements = 0;
+    for (const auto& ielement : elements(igridView)) {
+      if (!grid.isInterface(grid.entity(ielement.impl().hostEntity())))
+        DUNE_THROW(GridError, "Interface element is not on the interface!");
+      numberOfInterfaceElements++;
+    }
+
+    if (numberOfInterfaceElements != expected)
+      DUNE_THROW(GridError, "There are " << numberOfInterfaceElements
+                                         << " interface grid elements instead "
+                                         << "of " << expected << " expected!");
+
+    // The per-cell interface flags have to agree with the interface segments
+    for (const auto& facet : facets(gridView)) {
+      std::vector<std::size_t> ids;
+      for (std::size_t i = 0; i < facet.subEntities(dim); ++i) {
+        const auto& vertex = facet.impl().template subEntity<dim>(i);
+        ids.push_back(vertex.impl().hostEntity()->info().id);
+      }
+      std::sort(ids.begin(), ids.end());
+
+      if (grid.isInterface(facet) != (grid.interfaceSegments().count(ids) > 0))
+        DUNE_THROW(GridError, "Interface flag of facet is wrong!");
+    }
+
+    int numberOfInterfaceVertices = 0;
+    for (const auto& vertex : vertices(gridView))
+      if (grid.isInterface(vertex)) numberOfInterfaceVertices++;
+
+    if (numberOfInterfaceVertices != igridView.size(dim - 1))
+      DUNE_THROW(GridError, "There are " << igridView.size(dim - 1)
+                                         << " interface grid vertices instead "
+                                         << "of " << numberOfInterfaceVertices
+                                         << " expected!");
+
     return EXIT_SUCCESS;
   } catch (Dune::Exception& e) {
     std::cerr << "Dune reported error: " << e << std::endl;
@@ -0,0 +1,67 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/mmesh/mmesh.hh>
+#include <iostream>
+
+using namespace Dune;
+
+template <class Grid>
+void runTest(unsigned int cells) {
+  static constexpr int dim = Grid::dimension;
+  using GridFactory = MMeshStructuredGridFactory<Grid>;
+
+  FieldVector<double, dim> lowerLeft(0.0), upperRight(1.0);
+  std::array<unsigned int, dim> elements;
+  elements.fill(cells);
+
+  GridFactory gridFactory(lowerLeft, upperRight, elements);
+  Grid& grid = *gridFactory.grid();
+
+  const auto usage = grid.memoryUsage();
+  std::cout << "dim " << dim << ":\n" << usage << std::endl;
+
+  // the host grid additionally stores the infinite entities
+  if (usage.numElements < std::size_t(grid.size(0)) ||
+      usage.numVertices < std::size_t(grid.size(dim)))
+    DUNE_THROW(InvalidStateException, "Wrong number of host entities!");
+
+  if (usage.total() < usage.vertices + usage.elements)
+    DUNE_THROW(InvalidStateException, "Memory usage is inconsistent!");
+
+  // the geometry cache is reported once it is filled
+  grid.setGeometryCaching(true);
+  if (grid.memoryUsage().geometryCache == 0)
+    DUNE_THROW(InvalidStateException, "Geometry cache is not reported!");
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- Memory usage test --" << std::endl;
+
+    // the infos should not grow unnoticed
+    static_assert(sizeof(MMeshDefaults::VertexInfo) <= 24);
+    static_assert(sizeof(MMeshDefaults::ElementInfo<2>) <= 48);
+    static_assert(sizeof(MMeshDefaults::ElementInfo<3>) <= 80);
+
+    runTest<MovingMesh<2>>(20);
+    runTest<MovingMesh<3>>(6);
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
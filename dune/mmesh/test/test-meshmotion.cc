@@ -0,0 +1,110 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/common/timer.hh>
+#include <dune/mmesh/mmesh.hh>
+#include "cellvolumes.hh"
+#include <iostream>
+#include <limits>
+
+using namespace Dune;
+
+//! Return the minimal signed volume after moving all vertices by shifts
+template <class Grid, class Shifts>
+double movedMinSignedVolume(Grid& grid, const Shifts& shifts) {
+  grid.moveVertices(shifts);
+  const double minVolume = minSignedVolume(grid);
+
+  Shifts back = shifts;
+  for (auto& s : back) s *= -1.0;
+  grid.moveVertices(back);
+  return minVolume;
+}
+
+template <class Grid>
+void checkMotion(Grid& grid, typename MMeshMotion<Grid>::Operator op,
+                 double bandWidth) {
+  static constexpr int dim = Grid::dimension;
+  using GlobalCoordinate = FieldVector<double, dim>;
+
+  // translate the interface beyond the feasible fraction without bulk motion
+  const auto& igrid = grid.interfaceGrid();
+  const auto& iindexSet = igrid.leafIndexSet();
+  std::vector<GlobalCoordinate> ishifts(igrid.size(dim - 1));
+  for (auto& s : ishifts) {
+    s = 0.0;
+    s[0] = 0.5;
+  }
+  const double fraction = grid.maxInterfaceShiftFraction(ishifts);
+  for (auto& s : ishifts) s *= std::min(2.0 * fraction, 0.2);
+
+  MMeshMotion<Grid> motion(grid);
+  motion.setOperator(op);
+  motion.setBandWidth(bandWidth);
+
+  Dune::Timer timer;
+  const auto shifts = motion.shifts(ishifts);
+  std::cout << "dim " << dim << ": " << motion.iterations()
+            << " iterations in " << timer.elapsed() << "s" << std::endl;
+
+  if (motion.residual() > 1e-8)
+    DUNE_THROW(InvalidStateException, "CG did not converge!");
+
+  // interface shifts are kept, boundary vertices are fixed
+  const auto& indexSet = grid.leafIndexSet();
+  for (const auto& vertex : vertices(grid.leafGridView())) {
+    const auto& shift = shifts[indexSet.index(vertex)];
+    if (vertex.impl().isInterface()) {
+      const auto ivertex = igrid.entity(vertex.impl().hostEntity());
+      if (shift != ishifts[iindexSet.index(ivertex)])
+        DUNE_THROW(InvalidStateException, "Interface shift changed!");
+    } else if (Grid::RefinementStrategy::atBoundary(vertex)) {
+      if (shift != GlobalCoordinate(0.0))
+        DUNE_THROW(InvalidStateException, "Boundary vertex moved!");
+    }
+  }
+
+  // the bulk follows the interface such that no cell inverts
+  if (movedMinSignedVolume(grid, shifts) <= 0.0)
+    DUNE_THROW(InvalidStateException, "A cell has been inverted!");
+}
+
+template <class Grid>
+void runTest(Grid& grid) {
+  using Operator = typename MMeshMotion<Grid>::Operator;
+  const double infinity = std::numeric_limits<double>::infinity();
+  checkMotion(grid, Operator::laplace, infinity);
+  checkMotion(grid, Operator::laplace, 0.2);
+  checkMotion(grid, Operator::elasticity, infinity);
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- Mesh motion test --" << std::endl;
+
+    using Grid2D = Dune::MovingMesh<2>;
+    GmshGridFactory<Grid2D> gridFactory2d("grids/ellipse2d.msh");
+    runTest(*gridFactory2d.grid());
+
+    using Grid3D = Dune::MovingMesh<3>;
+    GmshGridFactory<Grid3D> gridFactory3d("grids/sphere3d.msh");
+    runTest(*gridFactory3d.grid());
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
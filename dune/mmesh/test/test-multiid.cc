@@ -0,0 +1,132 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/common/timer.hh>
+#include <dune/mmesh/mmesh.hh>
+#include <algorithm>
+#include <iostream>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace Dune;
+using MultiId = MMeshImpl::MultiId;
+
+//! The previous xor-shift hash for comparison
+struct XorShiftHash {
+  std::size_t operator()(const MultiId& id) const {
+    if (id.size() == 0) return 0;
+    std::hash<std::size_t> hasher;
+    std::size_t h = hasher(id[0]);
+    for (std::size_t i = 1; i < id.size(); ++i) h = h ^ (hasher(id[i]) << i);
+    return h;
+  }
+};
+
+//! Return the number of distinct hash values of the ids
+template <class Hash>
+std::size_t distinctHashes(const std::vector<MultiId>& ids) {
+  std::unordered_set<std::size_t> hashes;
+  for (const auto& id : ids) hashes.insert(Hash()(id));
+  return hashes.size();
+}
+
+//! Insert all ids into a map and look them up again
+template <class Hash>
+double mapWorkload(const std::vector<MultiId>& ids, int repetitions) {
+  Dune::Timer timer;
+  std::size_t sum = 0;
+  for (int r = 0; r < repetitions; ++r) {
+    std::unordered_map<MultiId, int, Hash> map;
+    for (std::size_t i = 0; i < ids.size(); ++i) map[ids[i]] = i;
+    for (const auto& id : ids) sum += map.at(id);
+  }
+  if (sum == std::size_t(-1)) std::cout << sum << std::endl;
+  return timer.elapsed();
+}
+
+template <class Grid>
+void runBenchmark(unsigned int cells, int repetitions) {
+  static constexpr int dim = Grid::dimension;
+  using GridFactory = MMeshStructuredGridFactory<Grid>;
+
+  FieldVector<double, dim> lowerLeft(0.0), upperRight(1.0);
+  std::array<unsigned int, dim> elements;
+  elements.fill(cells);
+
+  GridFactory gridFactory(lowerLeft, upperRight, elements);
+  Grid& grid = *gridFactory.grid();
+  const auto& gv = grid.leafGridView();
+  const auto& idSet = grid.globalIdSet();
+
+  // the ids of all entities as used by the id set, the partition helper
+  // (facets and edges) and the persistent container (elements)
+  std::vector<MultiId> ids;
+  Dune::Timer timer;
+  for (int r = 0; r < repetitions; ++r) {
+    ids.clear();
+    for (const auto& element : elements(gv))
+      for (int codim = 0; codim <= dim; ++codim)
+        for (std::size_t i = 0; i < element.subEntities(codim); ++i)
+          ids.push_back(idSet.subId(element, i, codim));
+  }
+  const double tIds = timer.elapsed();
+
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+  std::size_t expected = 0;
+  for (int codim = 0; codim <= dim; ++codim) expected += grid.size(codim);
+  if (ids.size() != expected)
+    DUNE_THROW(InvalidStateException, "Ids are not unique!");
+
+  const std::size_t distinct = distinctHashes<std::hash<MultiId>>(ids);
+  if (distinct != ids.size())
+    DUNE_THROW(InvalidStateException, "Hash values of the ids collide!");
+
+  const double tMap = mapWorkload<std::hash<MultiId>>(ids, repetitions);
+  const double tXor = mapWorkload<XorShiftHash>(ids, repetitions);
+
+  std::cout << "dim " << dim << ": " << ids.size() << " ids, "
+            << "subId " << tIds / repetitions << "s, "
+            << "distinct hashes " << distinct << " (xor-shift "
+            << distinctHashes<XorShiftHash>(ids) << "), "
+            << "map " << tMap / repetitions << "s (xor-shift "
+            << tXor / repetitions << "s)" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- MultiId test --" << std::endl;
+
+    // a MultiId is a plain value
+    MultiId a({std::size_t(3), std::size_t(1)});
+    MultiId b = a;
+    if (a != b || a.size() != 2 || a[0] != 3 || a[1] != 1)
+      DUNE_THROW(InvalidStateException, "MultiId copy is wrong!");
+    if (MultiId(std::array<std::size_t, 1>{2}) != MultiId(std::size_t(2)))
+      DUNE_THROW(InvalidStateException, "MultiId construction is wrong!");
+    if (!(MultiId(std::size_t(5)) < a))
+      DUNE_THROW(InvalidStateException, "MultiId ordering is wrong!");
+
+    const int repetitions = (argc > 1) ? std::stoi(argv[1]) : 5;
+    runBenchmark<MovingMesh<2>>(100, repetitions);
+    runBenchmark<MovingMesh<3>>(16, repetitions);
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,190 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/common/timer.hh>
+#include <dune/mmesh/mmesh.hh>
+#include "checkindexset.hh"
+#include <algorithm>
+#include <iostream>
+
+using namespace Dune;
+
+//! Vertex-vertex matrix in compressed row storage
+struct CRSMatrix {
+  std::vector<std::size_t> rowStart, column;
+  std::vector<double> value;
+
+  void mv(const std::vector<double>& x, std::vector<double>& y) const {
+    for (std::size_t r = 0; r + 1 < rowStart.size(); ++r) {
+      double sum = 0.0;
+      for (std::size_t k = rowStart[r]; k < rowStart[r + 1]; ++k)
+        sum += value[k] * x[column[k]];
+      y[r] = sum;
+    }
+  }
+};
+
+//! Return the graph Laplacian of the vertices
+template <class Grid>
+CRSMatrix laplacian(const Grid& grid) {
+  static constexpr int dim = Grid::dimension;
+  const auto& gv = grid.leafGridView();
+  const auto& indexSet = gv.indexSet();
+  const std::size_t n = indexSet.size(dim);
+
+  std::vector<std::vector<std::size_t>> neighbors(n);
+  for (const auto& element : elements(gv))
+    for (std::size_t k = 0; k < dim + 1; ++k)
+      for (std::size_t l = 0; l < dim + 1; ++l)
+        neighbors[indexSet.subIndex(element, k, dim)].push_back(
+            indexSet.subIndex(element, l, dim));
+
+  CRSMatrix A;
+  A.rowStart.push_back(0);
+  for (std::size_t r = 0; r < n; ++r) {
+    auto& row = neighbors[r];
+    std::sort(row.begin(), row.end());
+    row.erase(std::unique(row.begin(), row.end()), row.end());
+    for (auto c : row) {
+      A.column.push_back(c);
+      A.value.push_back(c == r ? double(row.size() - 1) : -1.0);
+    }
+    A.rowStart.push_back(A.column.size());
+  }
+  return A;
+}
+
+//! Print bandwidth and SpMV time, returns the sum of A x
+template <class Grid>
+double report(const Grid& grid, const std::string& name, int repetitions) {
+  static constexpr int dim = Grid::dimension;
+  const auto& gv = grid.leafGridView();
+  const auto A = laplacian(grid);
+
+  std::size_t bandwidth = 0;
+  double profile = 0.0;
+  for (std::size_t r = 0; r + 1 < A.rowStart.size(); ++r)
+    for (std::size_t k = A.rowStart[r]; k < A.rowStart[r + 1]; ++k) {
+      const std::size_t c = A.column[k];
+      const std::size_t d = (c > r) ? c - r : r - c;
+      bandwidth = std::max(bandwidth, d);
+      profile += d;
+    }
+  profile /= A.column.size();
+
+  // x is a function of the vertex positions, hence, sum(Ax) does not depend
+  // on the numbering
+  std::vector<double> x(gv.size(dim)), y(gv.size(dim));
+  for (const auto& vertex : vertices(gv)) {
+    const auto p = vertex.geometry().center();
+    x[gv.indexSet().index(vertex)] = p * p;
+  }
+
+  Dune::Timer timer;
+  for (int r = 0; r < repetitions; ++r) A.mv(x, y);
+  const double t = timer.elapsed();
+
+  std::cout << "  " << name << ": bandwidth " << bandwidth
+            << ", mean distance " << profile << ", SpMV "
+            << t / repetitions << "s" << std::endl;
+
+  double sum = 0.0;
+  for (double v : y) sum += std::abs(v);
+  return sum;
+}
+
+//! Scramble the host grid storage by inserting and removing vertices
+template <class Grid>
+void scramble(Grid& grid, int cycles) {
+  static constexpr int dim = Grid::dimension;
+
+  for (int cycle = 0; cycle < cycles; ++cycle) {
+    for (const auto& element : elements(grid.leafGridView()))
+      if (element.impl().hostEntity()->info().index % (7 + cycle) == 0)
+        grid.mark(1, element);
+
+    // removal is only supported in 2d
+    if constexpr (dim == 2) {
+      std::size_t count = 0;
+      for (const auto& vertex : vertices(grid.leafGridView())) {
+        if (vertex.impl().insertionLevel() == 0) continue;
+        if (count++ % 3 == 0) grid.removeVertex(vertex);
+      }
+    }
+
+    grid.preAdapt();
+    grid.adapt();
+    grid.postAdapt();
+  }
+}
+
+template <class Grid>
+void runBenchmark(unsigned int cells, int cycles, int repetitions) {
+  static constexpr int dim = Grid::dimension;
+  using GridFactory = MMeshStructuredGridFactory<Grid>;
+
+  FieldVector<double, dim> lowerLeft(0.0), upperRight(1.0);
+  std::array<unsigned int, dim> elements;
+  elements.fill(cells);
+
+  GridFactory gridFactory(lowerLeft, upperRight, elements);
+  Grid& grid = *gridFactory.grid();
+  scramble(grid, cycles);
+
+  std::cout << "dim " << dim << ": " << grid.size(dim) << " vertices"
+            << std::endl;
+
+  const double sumNone = report(grid, "host order", repetitions);
+
+  for (auto ordering : {MMeshOrdering::morton, MMeshOrdering::hilbert}) {
+    grid.setOrdering(ordering);
+    checkIndexSet(grid);
+
+    const double sum = report(
+        grid, ordering == MMeshOrdering::morton ? "morton" : "hilbert",
+        repetitions);
+    if (std::abs(sum - sumNone) > 1e-8 * sumNone)
+      DUNE_THROW(InvalidStateException, "SpMV result depends on numbering!");
+  }
+
+  // the numbering is kept during adaptation
+  scramble(grid, 1);
+  checkIndexSet(grid);
+
+  // the same with incremental index updates
+  GridFactory incrementalFactory(lowerLeft, upperRight, elements);
+  Grid& incremental = *incrementalFactory.grid();
+  incremental.setIncrementalAdaptation();
+  incremental.setOrdering(MMeshOrdering::hilbert);
+  checkIndexSet(incremental);
+
+  scramble(incremental, cycles);
+  checkIndexSet(incremental);
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- Ordering test --" << std::endl;
+
+    const int repetitions = (argc > 1) ? std::stoi(argv[1]) : 20;
+    runBenchmark<MovingMesh<2>>(100, 4, repetitions);
+    runBenchmark<MovingMesh<3>>(16, 2, repetitions);
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,168 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/common/timer.hh>
+#include <dune/grid/common/adaptcallback.hh>
+#include <dune/mmesh/mmesh.hh>
+#include <iostream>
+#include <map>
+#include <mutex>
+
+using namespace Dune;
+
+// the density of the father that is currently prolongated
+thread_local double density;
+
+//! Piecewise constant data stored by element ids, projected conservatively
+template <class Grid>
+class MassHandle : public AdaptDataHandle<Grid, MassHandle<Grid>> {
+  using Entity = typename Grid::template Codim<0>::Entity;
+  using IdType = typename Grid::GlobalIdSet::IdType;
+
+ public:
+  MassHandle(const Grid& grid, std::map<IdType, double>& mass)
+      : grid_(grid), mass_(mass), old_(mass) {}
+
+  void preCoarsening(const Entity& father) {}
+  void postRefinement(const Entity& father) {}
+
+  void prolongLocal(const Entity& father, const Entity& son, bool) {
+    // the son is contained in the father
+    const auto geo = son.geometryInFather();
+    for (int i = 0; i < geo.corners(); ++i) {
+      const auto x = geo.corner(i);
+      double sum = 0.0;
+      for (int k = 0; k < Grid::dimension; ++k) {
+        if (x[k] < -1e-8)
+          DUNE_THROW(InvalidStateException, "Son is not inside of father!");
+        sum += x[k];
+      }
+      if (sum > 1.0 + 1e-8)
+        DUNE_THROW(InvalidStateException, "Son is not inside of father!");
+    }
+
+    const IdType id = grid_.globalIdSet().id(father);
+    density = old_.at(id) / father.geometry().volume();
+  }
+
+  void restrictLocal(const Entity& father, const Entity& son,
+                     bool initialize) {
+    const IdType id = grid_.globalIdSet().id(father);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (initialize) mass_[id] = 0.0;
+    mass_[id] += density * son.geometry().volume();
+  }
+
+ private:
+  const Grid& grid_;
+  std::map<IdType, double>& mass_;
+  const std::map<IdType, double> old_;
+  std::mutex mutex_;
+};
+
+//! Refine around a moving point, project the mass and return the new masses
+template <class Grid>
+std::vector<double> projectionCycle(Grid& grid, int cycle) {
+  static constexpr int dim = Grid::dimension;
+  using IdType = typename Grid::GlobalIdSet::IdType;
+
+  FieldVector<double, dim> center(0.5);
+  center[0] = 0.2 + 0.05 * cycle;
+
+  // the mass of a linear density
+  std::map<IdType, double> mass;
+  double total = 0.0;
+  for (const auto& element : elements(grid.leafGridView())) {
+    const auto& geo = element.geometry();
+    const double m = geo.volume() * (1.0 + geo.center()[0]);
+    mass[grid.globalIdSet().id(element)] = m;
+    total += m;
+
+    auto d = geo.center();
+    d -= center;
+    if (d.two_norm() < 0.1) grid.mark(1, element);
+  }
+
+  MassHandle<Grid> handle(grid, mass);
+  grid.adapt(handle);
+
+  std::vector<double> result(grid.size(0));
+  double newTotal = 0.0;
+  for (const auto& element : elements(grid.leafGridView())) {
+    const double m = mass.at(grid.globalIdSet().id(element));
+    result[grid.leafIndexSet().index(element)] = m;
+    newTotal += m;
+  }
+
+  if (std::abs(newTotal - total) > 1e-8 * total)
+    DUNE_THROW(InvalidStateException, "The projection is not conservative!");
+
+  return result;
+}
+
+template <class Grid>
+void runTest(unsigned int cells, int cycles) {
+  static constexpr int dim = Grid::dimension;
+  using GridFactory = MMeshStructuredGridFactory<Grid>;
+
+  FieldVector<double, dim> lowerLeft(0.0), upperRight(1.0);
+  std::array<unsigned int, dim> elements;
+  elements.fill(cells);
+
+  GridFactory serialFactory(lowerLeft, upperRight, elements);
+  Grid& serial = *serialFactory.grid();
+
+  GridFactory parallelFactory(lowerLeft, upperRight, elements);
+  Grid& parallel = *parallelFactory.grid();
+  parallel.setParallelProjection();
+
+  double tSerial = 0.0, tParallel = 0.0;
+  for (int cycle = 0; cycle < cycles; ++cycle) {
+    Dune::Timer timer;
+    const auto serialMass = projectionCycle(serial, cycle);
+    tSerial += timer.elapsed();
+
+    timer.reset();
+    const auto parallelMass = projectionCycle(parallel, cycle);
+    tParallel += timer.elapsed();
+
+    // both grids are adapted identically
+    if (serialMass.size() != parallelMass.size())
+      DUNE_THROW(InvalidStateException, "The grids differ!");
+
+    for (std::size_t i = 0; i < serialMass.size(); ++i)
+      if (std::abs(serialMass[i] - parallelMass[i]) > 1e-12)
+        DUNE_THROW(InvalidStateException,
+                   "Serial and parallel projection differ!");
+  }
+
+  std::cout << "dim " << dim << ": " << serial.size(0) << " elements, "
+            << "serial " << tSerial / cycles << "s, parallel "
+            << tParallel / cycles << "s per cycle" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- Projection test --" << std::endl;
+
+    runTest<MovingMesh<2>>(50, 5);
+    runTest<MovingMesh<3>>(10, 3);
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,99 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/common/timer.hh>
+#include <dune/mmesh/mmesh.hh>
+#include <iostream>
+
+using namespace Dune;
+
+template <class Grid>
+void runTest(unsigned int cells) {
+  static constexpr int dim = Grid::dimension;
+  using GridFactory = MMeshStructuredGridFactory<Grid>;
+  using Quality = MMeshQuality<Grid>;
+
+  FieldVector<double, dim> lowerLeft(0.0), upperRight(1.0);
+  std::array<unsigned int, dim> elements;
+  elements.fill(cells);
+
+  GridFactory gridFactory(lowerLeft, upperRight, elements);
+  Grid& grid = *gridFactory.grid();
+
+  Dune::Timer timer;
+  Quality quality(grid);
+  quality.update();
+  std::cout << "dim " << dim << ": " << quality.size() << " cells in "
+            << timer.elapsed() << "s" << std::endl;
+
+  if (quality.size() != std::size_t(grid.size(0)))
+    DUNE_THROW(InvalidStateException, "Wrong number of cells!");
+
+  // the cells fill the unit cube
+  const auto volume = Quality::statistics(quality.volume());
+  if (std::abs(volume.mean * quality.size() - 1.0) > 1e-12)
+    DUNE_THROW(InvalidStateException, "Volumes do not sum up to 1!");
+
+  const auto radiusRatio = Quality::statistics(quality.radiusRatio());
+  const auto minAngle = Quality::statistics(quality.minAngle());
+  const auto maxAngle = Quality::statistics(quality.maxAngle());
+  std::cout << "  radius ratio in [" << radiusRatio.minimum << ", "
+            << radiusRatio.maximum << "], angles in [" << minAngle.minimum
+            << ", " << maxAngle.maximum << "]" << std::endl;
+
+  if (radiusRatio.minimum < 1.0 - 1e-12)
+    DUNE_THROW(InvalidStateException, "Radius ratio is smaller than 1!");
+
+  // the structured triangles are right isosceles
+  if constexpr (dim == 2) {
+    const auto edgeRatio = Quality::statistics(quality.edgeRatio());
+    if (std::abs(edgeRatio.maximum - std::sqrt(2.0)) > 1e-12 ||
+        std::abs(minAngle.minimum - 45.0) > 1e-10 ||
+        std::abs(maxAngle.maximum - 90.0) > 1e-10)
+      DUNE_THROW(InvalidStateException, "Wrong metrics of a right triangle!");
+  }
+
+  if (minAngle.minimum <= 0.0 || maxAngle.maximum >= 180.0)
+    DUNE_THROW(InvalidStateException, "Angles are out of range!");
+
+  // every cell is counted once
+  const auto histogram = Quality::histogram(quality.radiusRatio(), 10, 1., 3.);
+  std::size_t count = 0;
+  for (auto c : histogram) count += c;
+  if (count != quality.size())
+    DUNE_THROW(InvalidStateException, "Histogram is incomplete!");
+
+  // the metrics coincide when using the geometry cache
+  grid.setGeometryCaching(true);
+  Quality cached(grid);
+  cached.update();
+  for (std::size_t i = 0; i < quality.size(); ++i)
+    if (std::abs(cached.radiusRatio()[i] - quality.radiusRatio()[i]) > 1e-12)
+      DUNE_THROW(InvalidStateException, "Cached metrics differ!");
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- Quality test --" << std::endl;
+
+    runTest<MovingMesh<2>>(20);
+    runTest<MovingMesh<3>>(6);
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,132 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/mmesh/mmesh.hh>
+#include "cellvolumes.hh"
+#include <cmath>
+#include <iostream>
+#include <set>
+#include <vector>
+
+using namespace Dune;
+
+//! Remove all interior bulk vertices of a structured grid
+template <class Grid>
+void testBulk(unsigned int cells) {
+  static constexpr int dim = Grid::dimension;
+  using GridFactory = MMeshStructuredGridFactory<Grid>;
+
+  FieldVector<double, dim> lowerLeft(0.0), upperRight(1.0);
+  std::array<unsigned int, dim> numCells;
+  numCells.fill(cells);
+
+  GridFactory gridFactory(lowerLeft, upperRight, numCells);
+  Grid& grid = *gridFactory.grid();
+
+  const int numVertices = grid.size(dim);
+  const int numElements = grid.size(0);
+
+  for (const auto& vertex : vertices(grid.leafGridView()))
+    if (!Grid::RefinementStrategy::atBoundary(vertex))
+      grid.removeVertex(vertex);
+
+  grid.adapt();
+  grid.postAdapt();
+  std::cout << "bulk: " << numVertices << " -> " << grid.size(dim)
+            << " vertices, " << numElements << " -> " << grid.size(0)
+            << " elements" << std::endl;
+
+  if (grid.size(dim) >= numVertices)
+    DUNE_THROW(InvalidStateException, "No vertex has been removed!");
+  if (grid.size(0) >= numElements)
+    DUNE_THROW(InvalidStateException, "No element has vanished!");
+  if (invertedCells(grid) > 0)
+    DUNE_THROW(InvalidStateException, "The removal inverted a cell!");
+  if (std::abs(volume(grid) - 1.0) > 1e-12)
+    DUNE_THROW(InvalidStateException, "Volumes do not sum up to 1!");
+}
+
+//! Remove interface vertices that do not share an interface element
+template <class Grid>
+void testInterface(Grid& grid) {
+  static constexpr int dim = Grid::dimension;
+  const auto& igrid = grid.interfaceGrid();
+
+  auto eulerCharacteristic = [&]() {
+    return igrid.size(0) - igrid.size(1) + igrid.size(2);
+  };
+
+  const int numVertices = igrid.size(dim - 1);
+  const int euler = eulerCharacteristic();
+  const double bulkVolume = volume(grid);
+
+  std::set<typename Grid::GlobalIdSet::IdType> blocked;
+  for (const auto& ivertex : vertices(igrid.leafGridView())) {
+    if (!Grid::RefinementStrategy::isRemoveable(ivertex)) continue;
+
+    const auto vertex = grid.entity(ivertex.impl().hostEntity());
+    if (blocked.count(grid.globalIdSet().id(vertex))) continue;
+
+    for (const auto& element : incidentInterfaceElements(ivertex))
+      for (std::size_t i = 0; i < element.subEntities(dim - 1); ++i) {
+        const auto& v = element.template subEntity<dim - 1>(i);
+        const auto& hostEntity = v.impl().hostEntity();
+        blocked.insert(grid.globalIdSet().id(grid.entity(hostEntity)));
+      }
+
+    grid.removeVertex(ivertex);
+  }
+
+  grid.adapt();
+  grid.postAdapt();
+  std::cout << "interface: " << numVertices << " -> " << igrid.size(dim - 1)
+            << " vertices" << std::endl;
+
+  if (igrid.size(dim - 1) >= numVertices)
+    DUNE_THROW(InvalidStateException, "No interface vertex has been removed!");
+  if (eulerCharacteristic() != euler)
+    DUNE_THROW(InvalidStateException, "The topology of the interface changed!");
+
+  // every interface edge is shared by exactly two interface elements
+  const auto& iindexSet = igrid.leafIndexSet();
+  std::vector<int> edgeElements(igrid.size(1), 0);
+  for (const auto& element : elements(igrid.leafGridView()))
+    for (std::size_t i = 0; i < element.subEntities(1); ++i)
+      edgeElements[iindexSet.subIndex(element, i, 1)]++;
+  for (const int count : edgeElements)
+    if (count != 2)
+      DUNE_THROW(InvalidStateException, "The interface is not a manifold!");
+  if (invertedCells(grid) > 0)
+    DUNE_THROW(InvalidStateException, "The removal inverted a cell!");
+  if (std::abs(volume(grid) - bulkVolume) > 1e-12)
+    DUNE_THROW(InvalidStateException, "The bulk volume changed!");
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- Removal test --" << std::endl;
+
+    using Grid3D = Dune::MovingMesh<3>;
+    testBulk<Grid3D>(4);
+
+    GmshGridFactory<Grid3D> gridFactory("grids/sphere3d.msh");
+    testInterface(*gridFactory.grid());
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
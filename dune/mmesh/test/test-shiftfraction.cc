@@ -0,0 +1,90 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/mmesh/mmesh.hh>
+#include "cellvolumes.hh"
+#include <iostream>
+
+using namespace Dune;
+
+//! Return the minimal signed volume after moving the interface by t * shifts
+template <class Grid, class Shifts>
+double movedMinSignedVolume(Grid& grid, const Shifts& shifts, double t) {
+  Shifts scaled = shifts;
+  for (auto& s : scaled) s *= t;
+  grid.moveInterface(scaled);
+  const double minVolume = minSignedVolume(grid);
+
+  for (auto& s : scaled) s *= -1.0;
+  grid.moveInterface(scaled);
+  return minVolume;
+}
+
+template <class Grid>
+void checkFraction(Grid& grid, double translation) {
+  static constexpr int dim = Grid::dimension;
+  using GlobalCoordinate = FieldVector<double, dim>;
+
+  // translate the interface, such that some cells invert
+  const auto& igrid = grid.interfaceGrid();
+  std::vector<GlobalCoordinate> shifts(igrid.size(dim - 1));
+  for (auto& s : shifts) {
+    s = 0.0;
+    s[0] = translation;
+  }
+
+  std::vector<double> fractions;
+  const double fraction = grid.maxInterfaceShiftFraction(shifts, fractions);
+  std::cout << "dim " << dim << ": feasible fraction " << fraction
+            << std::endl;
+
+  if (fraction <= 0.0 || fraction >= 1.0)
+    DUNE_THROW(InvalidStateException, "The fraction should be in (0, 1)!");
+
+  // the global fraction is the minimum of the vertex fractions
+  double minFraction = 1.0;
+  for (double f : fractions) minFraction = std::min(minFraction, f);
+  if (minFraction != fraction)
+    DUNE_THROW(InvalidStateException, "Vertex fractions are inconsistent!");
+
+  // the fraction is sharp
+  if (movedMinSignedVolume(grid, shifts, 0.99 * fraction) <= 0.0)
+    DUNE_THROW(InvalidStateException, "A cell inverts before the fraction!");
+  if (movedMinSignedVolume(grid, shifts, 1.01 * fraction) >= 0.0)
+    DUNE_THROW(InvalidStateException, "No cell inverts after the fraction!");
+
+  // the grid is restored
+  if (movedMinSignedVolume(grid, shifts, 0.0) <= 0.0)
+    DUNE_THROW(InvalidStateException, "The grid has not been restored!");
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- Shift fraction test --" << std::endl;
+
+    using Grid2D = Dune::MovingMesh<2>;
+    GmshGridFactory<Grid2D> gridFactory2d("grids/ellipse2d.msh");
+    checkFraction(*gridFactory2d.grid(), 0.5);
+
+    using Grid3D = Dune::MovingMesh<3>;
+    GmshGridFactory<Grid3D> gridFactory3d("grids/sphere3d.msh");
+    checkFraction(*gridFactory3d.grid(), 0.5);
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
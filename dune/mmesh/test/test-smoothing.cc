@@ -0,0 +1,122 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/common/timer.hh>
+#include <dune/mmesh/mmesh.hh>
+#include "cellvolumes.hh"
+#include <cmath>
+#include <iostream>
+
+using namespace Dune;
+
+template <class Grid>
+void checkSmoothing(Grid& grid, typename MMeshSmoothing<Grid>::Method method) {
+  static constexpr int dim = Grid::dimension;
+  using GlobalCoordinate = FieldVector<double, dim>;
+  using Quality = MMeshQuality<Grid>;
+  using Smoothing = MMeshSmoothing<Grid>;
+
+  // expand the interface by a feasible fraction of 5 percent
+  const auto& igrid = grid.interfaceGrid();
+  const auto& iindexSet = igrid.leafIndexSet();
+  std::vector<GlobalCoordinate> shifts(igrid.size(dim - 1));
+  for (const auto& vertex : vertices(igrid.leafGridView())) {
+    shifts[iindexSet.index(vertex)] = vertex.geometry().center();
+    shifts[iindexSet.index(vertex)] *= 0.05;
+  }
+  const double fraction = grid.maxInterfaceShiftFraction(shifts);
+  for (auto& s : shifts) s *= 0.5 * fraction;
+  grid.moveInterface(shifts);
+
+  Quality before(grid);
+  before.update();
+
+  // store the interface and boundary vertices
+  std::vector<GlobalCoordinate> fixed;
+  for (const auto& vertex : vertices(grid.leafGridView()))
+    if (vertex.impl().isInterface() ||
+        Grid::RefinementStrategy::atBoundary(vertex))
+      fixed.push_back(vertex.geometry().center());
+
+  Smoothing smoothing(grid);
+  smoothing.setBandWidth(0.25);
+  smoothing.setMethod(method);
+
+  Dune::Timer timer;
+  const std::size_t moved = smoothing.smooth();
+  const double elapsed = timer.elapsed();
+
+  Quality after(grid);
+  after.update();
+
+  const auto minBefore = Quality::statistics(before.minAngle()).minimum;
+  const auto minAfter = Quality::statistics(after.minAngle()).minimum;
+  const char* name = method == Smoothing::Method::odt ? "odt" : "cpt";
+  std::cout << "dim " << dim << " " << name << ": moved " << moved
+            << " vertices in " << elapsed << "s, min angle " << minBefore
+            << " -> " << minAfter << std::endl;
+
+  if (moved == 0) DUNE_THROW(InvalidStateException, "No vertex moved!");
+
+  if (minSignedVolume(grid) <= 0.0)
+    DUNE_THROW(InvalidStateException, "A cell has been inverted!");
+  if (minAfter < minBefore - 1e-10)
+    DUNE_THROW(InvalidStateException, "The minimal angle got worse!");
+
+  // interface vertices are fixed, boundary vertices stay on the boundary of
+  // the box, i.e. at least one coordinate is kept (in 3d all are kept)
+  std::size_t i = 0;
+  for (const auto& vertex : vertices(grid.leafGridView())) {
+    const bool isInterface = vertex.impl().isInterface();
+    if (!isInterface && !Grid::RefinementStrategy::atBoundary(vertex))
+      continue;
+
+    const auto x = vertex.geometry().center();
+    const auto& y = fixed[i++];
+    int kept = 0;
+    for (int k = 0; k < dim; ++k)
+      if (std::abs(x[k] - y[k]) < 1e-14) ++kept;
+
+    if (isInterface && kept < dim)
+      DUNE_THROW(InvalidStateException, "An interface vertex has moved!");
+    if (kept < (dim == 2 ? 1 : dim))
+      DUNE_THROW(InvalidStateException, "A boundary vertex has left!");
+  }
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- Smoothing test --" << std::endl;
+
+    using Grid2D = Dune::MovingMesh<2>;
+    using Method2D = MMeshSmoothing<Grid2D>::Method;
+    for (const auto method : {Method2D::odt, Method2D::cpt}) {
+      GmshGridFactory<Grid2D> gridFactory2d("grids/ellipse2d.msh");
+      checkSmoothing(*gridFactory2d.grid(), method);
+    }
+
+    using Grid3D = Dune::MovingMesh<3>;
+    using Method3D = MMeshSmoothing<Grid3D>::Method;
+    for (const auto method : {Method3D::odt, Method3D::cpt}) {
+      GmshGridFactory<Grid3D> gridFactory3d("grids/sphere3d.msh");
+      checkSmoothing(*gridFactory3d.grid(), method);
+    }
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,165 @@
+// -*- tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 2 -*-
+// vi: set et ts=4 sw=2 sts=2:
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+#include <dune/common/exceptions.hh>  // We use exceptions
+#include <dune/common/hybridutilities.hh>
+#include <dune/common/parallel/mpihelper.hh>  // An initializer of MPI
+#include <dune/common/timer.hh>
+#include <dune/mmesh/mmesh.hh>
+#include <iostream>
+
+using namespace Dune;
+
+//! Check the constexpr tables against the reference element
+template <int dim>
+void checkTables() {
+  const auto& ref = MMeshImpl::ref<dim>();
+
+  Hybrid::forEach(std::make_index_sequence<dim + 1>{}, [&](auto codim) {
+    constexpr auto sizes = MMeshImpl::simplexSubEntities<dim, codim>();
+    for (int cc = codim; cc <= dim; ++cc)
+      if (sizes[cc] != (unsigned int)ref.size(0, codim, cc))
+        DUNE_THROW(InvalidStateException, "Number of subentities differs!");
+  });
+
+  for (int cc = 0; cc <= dim; ++cc)
+    for (int i = 0; i < ref.size(cc); ++i)
+      for (int k = 0; k < ref.size(i, cc, dim); ++k)
+        if (MMeshImpl::refSubVertex<dim>(i, cc, k) !=
+            ref.subEntity(i, cc, k, dim))
+          DUNE_THROW(InvalidStateException, "Subentity table differs!");
+}
+
+//! Check the inverse index permutation and the facet mappings
+template <class Grid>
+void checkGrid(const Grid& grid) {
+  static constexpr int dim = Grid::dimension;
+  const auto& gv = grid.leafGridView();
+  const auto& indexSet = gv.indexSet();
+
+  for (const auto& element : elements(gv)) {
+    const auto& hostEntity = element.impl().hostEntity();
+    const auto& info = hostEntity->info();
+
+    for (int k = 0; k < dim + 1; ++k)
+      if (info.duneIndex[info.cgalIndex[k]] != (std::size_t)k)
+        DUNE_THROW(InvalidStateException, "Inverse permutation is wrong!");
+
+    for (int j = 0; j < dim + 1; ++j) {
+      const auto second =
+          MMeshImpl::duneFacetToCgalSecond<dim>(j, info.cgalIndex);
+      const typename Grid::template HostGridEntity<1> facet(hostEntity,
+                                                             second);
+      if (MMeshImpl::cgalFacetToDuneFacet<dim>(facet) != (std::size_t)j)
+        DUNE_THROW(InvalidStateException, "Facet mapping is wrong!");
+    }
+
+    Hybrid::forEach(std::make_index_sequence<dim + 1>{}, [&](auto codim) {
+      for (std::size_t i = 0; i < element.subEntities(codim); ++i) {
+        const auto& sub = element.template subEntity<codim>(i);
+        if (indexSet.subIndex(element, i, codim) != indexSet.index(sub))
+          DUNE_THROW(InvalidStateException,
+                     "Codim " << codim << " subIndex and index differ!");
+
+        // the vertices of the subentity are the ones of the reference element
+        if constexpr (codim > 0 && codim < dim)
+          for (std::size_t k = 0; k < sub.subEntities(dim); ++k)
+            if (indexSet.index(sub.impl().template subEntity<dim>(k)) !=
+                indexSet.subIndex(element,
+                                  MMeshImpl::refSubVertex<dim>(i, codim, k),
+                                  dim))
+              DUNE_THROW(InvalidStateException,
+                         "Codim " << codim << " vertex numbering differs!");
+      }
+    });
+  }
+}
+
+//! Sum up all subindices of all elements
+template <class GridView>
+std::size_t traverse(const GridView& gv) {
+  static constexpr int dim = GridView::dimension;
+  const auto& indexSet = gv.indexSet();
+
+  std::size_t sum = 0;
+  for (const auto& element : elements(gv))
+    for (int codim = 0; codim <= dim; ++codim)
+      for (std::size_t i = 0; i < element.subEntities(codim); ++i)
+        sum += indexSet.subIndex(element, i, codim);
+  return sum;
+}
+
+template <class Grid>
+void runBenchmark(unsigned int cells, int repetitions) {
+  static constexpr int dim = Grid::dimension;
+  using GridFactory = MMeshStructuredGridFactory<Grid>;
+
+  checkTables<dim>();
+
+  FieldVector<double, dim> lowerLeft(0.0), upperRight(1.0);
+  std::array<unsigned int, dim> elements;
+  elements.fill(cells);
+
+  GridFactory gridFactory(lowerLeft, upperRight, elements);
+  Grid& grid = *gridFactory.grid();
+  const auto& gv = grid.leafGridView();
+
+  checkGrid(grid);
+
+  // lookup of the facet vertices by the tables and the reference element
+  const auto& ref = MMeshImpl::ref<dim>();
+  const int lookups = repetitions * grid.size(0);
+
+  Dune::Timer timer;
+  std::size_t sumRef = 0;
+  for (int r = 0; r < lookups; ++r)
+    for (int i = 0; i < dim + 1; ++i)
+      for (int k = 0; k < dim; ++k) sumRef += ref.subEntity(i, 1, k, dim);
+  const double tRef = timer.elapsed();
+
+  timer.reset();
+  std::size_t sumTable = 0;
+  for (int r = 0; r < lookups; ++r)
+    for (int i = 0; i < dim + 1; ++i)
+      for (int k = 0; k < dim; ++k)
+        sumTable += MMeshImpl::refSubVertex<dim>(i, 1, k);
+  const double tTable = timer.elapsed();
+
+  if (sumRef != sumTable)
+    DUNE_THROW(InvalidStateException, "Table lookups differ!");
+
+  timer.reset();
+  std::size_t sum = 0;
+  for (int r = 0; r < repetitions; ++r) sum += traverse(gv);
+  const double tTraverse = timer.elapsed();
+
+  std::cout << "dim " << dim << ": " << grid.size(0) << " elements, "
+            << "facet vertex lookup reference " << tRef << "s, table "
+            << tTable << "s, subIndex traversal " << tTraverse / repetitions
+            << "s (checksum " << sum << ")" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  try {
+    MPIHelper::instance(argc, argv);
+    std::cout << "-- Subentity test --" << std::endl;
+
+    const int repetitions = (argc > 1) ? std::stoi(argv[1]) : 10;
+    runBenchmark<MovingMesh<2>>(64, repetitions);
+    runBenchmark<MovingMesh<3>>(16, repetitions);
+
+    return EXIT_SUCCESS;
+  } catch (Dune::Exception& e) {
+    std::cerr << "Dune reported error: " << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (CGAL::Failure_exception& e) {
+    std::cerr << "CGAL reported error: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cerr << "Unknown exception thrown!" << std::endl;
+    return EXIT_FAILURE;
+  }
+}
@@ -3,13 +3,13 @@
 
 #if HAVE_DUNE_FEM
 
+#include <array>
 #include <dune/common/exceptions.hh>
 #include <dune/fem/common/intersectionside.hh>
 #include <dune/fem/function/localfunction/bindable.hh>
 #include <dune/fem/function/localfunction/const.hh>
 #include <dune/fempy/py/grid/function.hh>
 #include <dune/fempy/py/grid/gridpart.hh>
-#include <dune/geometry/multilineargeometry.hh>
 #include <dune/python/common/typeregistry.hh>
 
 namespace Dune {
@@ -20,7 +20,12 @@ namespace Fem {
 // Distance //
 //////////////
 
-template <class GV>
+/** \brief Piecewise linear interpolation of the (signed) vertex distances
+ *
+ *  The vertex values are stored in a fixed size array on bind and evaluated
+ *  in barycentric coordinates, hence, binding does not allocate.
+ */
+template <class GV, bool isSigned = false>
 struct Distance
     : public BindableGridFunctionWithSpace<FemPy::GridPart<GV>,
                                            Dune::FieldVector<double, 1>> {
@@ -33,50 +38,101 @@ struct Distance
   static constexpr bool scalar = true;
 
   Distance(const GridView &gridView)
-      : Base(FemPy::gridPart<GridView>(gridView), "distance", 0),
-        interpolation_(GeometryTypes::simplex(dim),
-                       std::vector<Dune::FieldVector<double, 1>>()) {}
+      : Base(FemPy::gridPart<GridView>(gridView),
+             isSigned ? "signeddistance" : "distance", 0) {}
 
   void bind(const typename Base::EntityType &entity) {
     Base::bind(entity);
 
     const auto &distance = this->gridPart().grid().indicator().distance();
-
-    std::vector<Dune::FieldVector<double, 1>> distances;
-    distances.resize(dim + 1);
-    for (std::size_t i = 0; i < entity.subEntities(dim); ++i) {
+    for (std::size_t i = 0; i < dim + 1; ++i) {
       const auto &vertex = entity.template subEntity<dim>(i);
-      distances[i] = distance(vertex);
+      if constexpr (isSigned)
+        values_[i] = distance.signedDistance(vertex);
+      else
+        values_[i] = distance(vertex);
     }
-
-    interpolation_ =
-        Dune::MultiLinearGeometry<double, dim, 1>(entity.type(), distances);
   }
 
  public:
   template <class Point>
   void evaluate(const Point &x, RangeType &ret) const {
-    auto xLocal = Dune::Fem::coordinate(x);
-    ret = interpolation_.global(xLocal);
+    const auto xLocal = Dune::Fem::coordinate(x);
+    ret = values_[0];
+    for (std::size_t i = 0; i < dim; ++i)
+      ret += (values_[i + 1] - values_[0]) * xLocal[i];
   }
 
   template <class Point>
   void jacobian(const Point &x, typename Base::JacobianRangeType &ret) const {
+    Dune::FieldVector<double, dim> localGradient;
+    for (std::size_t i = 0; i < dim; ++i)
+      localGradient[i] = values_[i + 1] - values_[0];
+
     const auto geo = this->entity().geometry();
+    const auto xLocal = Dune::Fem::coordinate(x);
+    geo.jacobianInverseTransposed(xLocal).mv(localGradient, ret[0]);
+  }
 
-    Dune::FieldVector<double, dim> p;
-    RangeType dt0;
-    auto t0 = geo.local(p);
-    evaluate(t0, dt0);
-
-    RangeType dt;
-    for (std::size_t i = 0; i < dim; ++i) {
-      p[i] = 1.;
-      auto t = geo.local(p);
-      p[i] = 0.;
-      evaluate(t, dt);
-      ret[0][i] = dt - dt0;
-    }
+  template <class Point>
+  void hessian(const Point &x, typename Base::HessianRangeType &ret) const {
+    ret = typename Base::HessianRangeType(0);
+  }
+
+ private:
+  std::array<double, dim + 1> values_;
+};
+
+template <class GridView, bool isSigned>
+inline static void registerDistance(
+    pybind11::module module,
+    pybind11::class_<Distance<GridView, isSigned>> cls) {
+  using pybind11::operator""_a;
+
+  cls.def(pybind11::init([](const GridView &gridView) {
+            return Distance<GridView, isSigned>(gridView);
+          }),
+          "gridView"_a, pybind11::keep_alive<1, 2>());
+
+  cls.def_property_readonly(
+      "scalar", [](Distance<GridView, isSigned> &self) { return true; });
+
+  Dune::FemPy::registerGridFunction(module, cls);
+}
+
+///////////
+// Phase //
+///////////
+
+//! Piecewise constant phase (0 or 1) of the elements
+template <class GV>
+struct Phase
+    : public BindableGridFunctionWithSpace<FemPy::GridPart<GV>,
+                                           Dune::FieldVector<double, 1>> {
+  using GridView = GV;
+  using GridPartType = FemPy::GridPart<GridView>;
+  using Base =
+      BindableGridFunctionWithSpace<GridPartType, Dune::FieldVector<double, 1>>;
+  using RangeType = typename Base::RangeType;
+  static constexpr bool scalar = true;
+
+  Phase(const GridView &gridView)
+      : Base(FemPy::gridPart<GridView>(gridView), "phase", 0) {}
+
+  void bind(const typename Base::EntityType &entity) {
+    Base::bind(entity);
+    phase_ = this->gridPart().grid().indicator().distance().phase(entity);
+  }
+
+ public:
+  template <class Point>
+  void evaluate(const Point &x, RangeType &ret) const {
+    ret = phase_;
+  }
+
+  template <class Point>
+  void jacobian(const Point &x, typename Base::JacobianRangeType &ret) const {
+    ret = typename Base::JacobianRangeType(0);
   }
 
   template <class Point>
@@ -85,21 +141,21 @@ struct Distance
   }
 
  private:
-  Dune::MultiLinearGeometry<double, dim, 1> interpolation_;
+  double phase_;
 };
 
 template <class GridView>
-inline static void registerDistance(pybind11::module module,
-                                    pybind11::class_<Distance<GridView>> cls) {
+inline static void registerPhase(pybind11::module module,
+                                 pybind11::class_<Phase<GridView>> cls) {
   using pybind11::operator""_a;
 
   cls.def(pybind11::init([](const GridView &gridView) {
-            return Distance<GridView>(gridView);
+            return Phase<GridView>(gridView);
           }),
           "gridView"_a, pybind11::keep_alive<1, 2>());
 
   cls.def_property_readonly("scalar",
-                            [](Distance<GridView> &self) { return true; });
+                            [](Phase<GridView> &self) { return true; });
 
   Dune::FemPy::registerGridFunction(module, cls);
 }
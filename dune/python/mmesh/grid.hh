@@ -9,6 +9,7 @@
 #include <dune/python/pybind11/stl.h>
 
 #include <array>
+#include <dune/common/exceptions.hh>
 #include <dune/common/hybridutilities.hh>
 #include <dune/common/iteratorrange.hh>
 #include <dune/geometry/referenceelements.hh>
@@ -25,7 +26,10 @@
 #include <map>
 #include <memory>
 #include <sstream>
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace Dune {
 
@@ -94,12 +98,45 @@ void registerHierarchicalGrid(
           Ensure the non-degeneration of the mesh after movement of the interface vertices
         )doc");
 
+  cls.def(
+      "maxInterfaceShiftFraction",
+      [](const Grid &self, const std::vector<FieldVector> &shifts) {
+        std::vector<double> fractions;
+        const double fraction =
+            self.maxInterfaceShiftFraction(shifts, fractions);
+        return pybind11::make_tuple(
+            fraction,
+            pybind11::array_t<double>(fractions.size(), fractions.data()));
+      },
+      R"doc(
+          Return the largest fraction of the interface shifts that keeps all cells positively oriented, globally and per interface vertex index
+        )doc");
+
   cls.def(
       "markElements", [](Grid &self) { return self.markElements(); },
       R"doc(
           Mark all elements in accordance to the default indicator
         )doc");
 
+  cls.def(
+      "setSignedDistance",
+      [](Grid &self, bool isSigned) {
+        self.indicator().setSignedDistance(isSigned);
+      },
+      R"doc(
+          Enable the signed distance and the phase classification of the elements
+        )doc");
+
+  cls.def(
+      "indicatorValues",
+      [](const Grid &self) {
+        const auto &values = self.indicatorValues();
+        return pybind11::array_t<std::int8_t>(values.size(), values.data());
+      },
+      R"doc(
+          Return the indicator values of the last markElements call indexed by the leaf index
+        )doc");
+
   cls.def(
       "adapt", [](Grid &self) { self.adapt(); },
       R"doc(
@@ -133,6 +170,51 @@ void registerHierarchicalGrid(
           Move all vertices of the triangulation by the given movement
         )doc");
 
+  cls.def(
+      "meshMotion",
+      [](const Grid &self, const std::vector<FieldVector> &shifts,
+         double bandWidth) {
+        Dune::MMeshMotion<Grid> motion(self);
+        motion.setBandWidth(bandWidth);
+        return motion.shifts(shifts);
+      },
+      R"doc(
+          Return the shifts of all vertices by extending the interface shifts harmonically to the bulk vertices closer to the interface than the band width (inf for all), can be passed to moveVertices
+        )doc");
+
+  cls.def(
+      "smoothVertices",
+      [](Grid &self, double bandWidth, int iterations) {
+        Dune::MMeshSmoothing<Grid> smoothing(self);
+        smoothing.setBandWidth(bandWidth);
+        smoothing.setIterations(iterations);
+        return smoothing.smooth();
+      },
+      R"doc(
+          Smooth the bulk vertices closer to the interface than the band width by ODT smoothing, returns the number of moved vertices
+        )doc");
+
+  cls.def(
+      "smoothVertices",
+      [](Grid &self, double bandWidth, int iterations,
+         const std::string &method) {
+        using Smoothing = Dune::MMeshSmoothing<Grid>;
+        Smoothing smoothing(self);
+        smoothing.setBandWidth(bandWidth);
+        smoothing.setIterations(iterations);
+        if (method == "odt")
+          smoothing.setMethod(Smoothing::Method::odt);
+        else if (method == "cpt")
+          smoothing.setMethod(Smoothing::Method::cpt);
+        else
+          DUNE_THROW(InvalidStateException,
+                     "Unknown smoothing method " << method << "!");
+        return smoothing.smooth();
+      },
+      R"doc(
+          Smooth the bulk vertices closer to the interface than the band width by ODT ("odt") or CPT ("cpt") smoothing, returns the number of moved vertices
+        )doc");
+
   cls.def(
       "isInterface",
       [](Grid &self, const Intersection &intersection) {
@@ -190,6 +272,80 @@ void registerHierarchicalGrid(
           Remove adaption markers and connected components
         )doc");
 
+  cls.def(
+      "memoryUsage",
+      [](const Grid &self) {
+        const auto usage = self.memoryUsage();
+        pybind11::dict result;
+        result["vertices"] = usage.vertices;
+        result["elements"] = usage.elements;
+        result["bytesPerVertex"] = usage.bytesPerVertex;
+        result["bytesPerElement"] = usage.bytesPerElement;
+        result["indexSet"] = usage.indexSet;
+        result["interface"] = usage.interface;
+        result["partition"] = usage.partition;
+        result["geometryCache"] = usage.geometryCache;
+        result["adaptation"] = usage.adaptation;
+        result["total"] = usage.total();
+        return result;
+      },
+      R"doc(
+          Return the memory used by the grid in bytes broken down by entity type
+        )doc");
+
+  auto qualityDict = [](const Grid &self, std::size_t bins) {
+    using Quality = Dune::MMeshQuality<Grid>;
+    Quality quality(self);
+    quality.update();
+
+    const std::vector<std::pair<const char *, const std::vector<double> &>>
+        metrics = {{"volume", quality.volume()},
+                   {"edgeRatio", quality.edgeRatio()},
+                   {"radiusRatio", quality.radiusRatio()},
+                   {"minAngle", quality.minAngle()},
+                   {"maxAngle", quality.maxAngle()}};
+
+    pybind11::dict result, statistics, histograms;
+    for (const auto &[name, values] : metrics) {
+      result[name] = pybind11::array_t<double>(values.size(), values.data());
+
+      const auto s = Quality::statistics(values);
+      pybind11::dict stats;
+      stats["minimum"] = s.minimum;
+      stats["maximum"] = s.maximum;
+      stats["mean"] = s.mean;
+      statistics[name] = stats;
+
+      const auto counts =
+          Quality::histogram(values, bins, s.minimum, s.maximum);
+      pybind11::dict histogram;
+      histogram["counts"] =
+          pybind11::array_t<std::size_t>(counts.size(), counts.data());
+      histogram["lower"] = s.minimum;
+      histogram["upper"] = s.maximum;
+      histograms[name] = histogram;
+    }
+    result["statistics"] = statistics;
+    result["histograms"] = histograms;
+    return result;
+  };
+
+  cls.def(
+      "quality",
+      [qualityDict](const Grid &self) { return qualityDict(self, 10); },
+      R"doc(
+          Return the quality metrics of all cells as numpy arrays indexed by the leaf index, their minimum, maximum and mean in statistics and histograms with 10 bins between minimum and maximum in histograms
+        )doc");
+
+  cls.def(
+      "quality",
+      [qualityDict](const Grid &self, std::size_t bins) {
+        return qualityDict(self, bins);
+      },
+      R"doc(
+          Return the quality metrics of all cells as numpy arrays indexed by the leaf index, their minimum, maximum and mean in statistics and histograms with the given number of bins between minimum and maximum in histograms
+        )doc");
+
   cls.def(
       "isTip",
       [](Grid &self, const InterfaceVertex &interfaceVertex) {
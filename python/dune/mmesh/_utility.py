@@ -1,6 +1,6 @@
 """The utility module.
 
-This file includes: interfaceIndicator, normals, distance, domainMarker, interfaceDomainMarker, edgeMovement, interfaceEdgeMovement
+This file includes: interfaceIndicator, normals, distance, signedDistance, phase, domainMarker, interfaceDomainMarker, edgeMovement, interfaceEdgeMovement
 """
 
 import io
@@ -126,6 +126,52 @@ def distance(grid):
   return distanceFunction
 
 
+def signedDistance(grid):
+  """Return function representing the signed distance to a closed interface
+
+  Args:
+    grid: The grid.
+
+  Returns:
+    Piecewise linear grid function, negative inside the interface.
+  """
+
+  #pylint: disable=import-outside-toplevel
+  if grid.dimension == 2:
+    import dune.mmesh._utility2d as module
+  else:
+    import dune.mmesh._utility3d as module
+  #pylint: enable=import-outside-toplevel
+
+  grid.hierarchicalGrid.setSignedDistance(True)
+  distanceModule = module.SignedDistance(grid.hierarchicalGrid.leafView)
+  distanceFunction = GridFunction(distanceModule)
+  return distanceFunction
+
+
+def phase(grid):
+  """Return the phase of the elements separated by a closed interface
+
+  Args:
+    grid: The grid.
+
+  Returns:
+    Piecewise constant grid function, 1 inside and 0 outside the interface.
+  """
+
+  #pylint: disable=import-outside-toplevel
+  if grid.dimension == 2:
+    import dune.mmesh._utility2d as module
+  else:
+    import dune.mmesh._utility3d as module
+  #pylint: enable=import-outside-toplevel
+
+  grid.hierarchicalGrid.setSignedDistance(True)
+  phaseModule = module.Phase(grid.hierarchicalGrid.leafView)
+  phaseFunction = GridFunction(phaseModule)
+  return phaseFunction
+
+
 def domainMarker(grid, wrapped=False):
   """Return domain markers passed by .msh grid file.
 
@@ -52,6 +52,33 @@ PYBIND11_MODULE(_utility3d, module) {
                                      "dune/python/mmesh/distance.hh"})
           .first;
   Dune::Fem::registerDistance(module, clsDistance);
+
+  // SignedDistance
+  auto clsSignedDistance =
+      Dune::Python::insertClass<Dune::Fem::Distance<
+          typename Dune::MovingMesh<3>::LeafGridView, true> >(
+          module, "SignedDistance",
+          Dune::Python::GenerateTypeName(
+              "Dune::Fem::Distance<typename "
+              "Dune::MovingMesh<3>::LeafGridView, true>"),
+          Dune::Python::IncludeFiles{"dune/mmesh/mmesh.hh",
+                                     "dune/python/grid/hierarchical.hh",
+                                     "dune/python/mmesh/distance.hh"})
+          .first;
+  Dune::Fem::registerDistance(module, clsSignedDistance);
+
+  // Phase
+  auto clsPhase =
+      Dune::Python::insertClass<
+          Dune::Fem::Phase<typename Dune::MovingMesh<3>::LeafGridView> >(
+          module, "Phase",
+          Dune::Python::GenerateTypeName("Dune::Fem::Phase<typename "
+                                         "Dune::MovingMesh<3>::LeafGridView>"),
+          Dune::Python::IncludeFiles{"dune/mmesh/mmesh.hh",
+                                     "dune/python/grid/hierarchical.hh",
+                                     "dune/python/mmesh/distance.hh"})
+          .first;
+  Dune::Fem::registerPhase(module, clsPhase);
 }
 
 #endif  // HAVE_DUNE_FEM